@@ -0,0 +1,33 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "throttled_copy.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace vecmem::benchmark {
+
+throttled_copy::throttled_copy(double bandwidth) : m_bandwidth(bandwidth) {}
+
+void throttled_copy::do_copy(std::size_t size, const void* from, void* to,
+                             type::copy_type) const {
+
+    const auto end =
+        std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(size) /
+                                          m_bandwidth));
+    std::memcpy(to, from, size);
+    std::this_thread::sleep_until(end);
+}
+
+}  // namespace vecmem::benchmark
@@ -0,0 +1,42 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::benchmark {
+
+/// Copy object simulating a bandwidth-limited link
+///
+/// Every "low level" copy takes (at least) as much time as it would take to
+/// transfer its bytes over a link of the specified bandwidth. Without keeping
+/// the CPU busy for that time, similar to how a DMA engine would behave.
+///
+class throttled_copy : public copy {
+
+public:
+    /// Constructor with the simulated bandwidth in bytes per second
+    throttled_copy(double bandwidth);
+
+protected:
+    /// Perform a throttled memory copy
+    void do_copy(std::size_t size, const void* from, void* to,
+                 type::copy_type cptype) const override;
+
+private:
+    /// The simulated bandwidth of the link in bytes per second
+    double m_bandwidth;
+
+};  // class throttled_copy
+
+}  // namespace vecmem::benchmark
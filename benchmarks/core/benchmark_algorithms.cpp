@@ -0,0 +1,173 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/algorithms.hpp>
+#include <vecmem/utils/thread_pool.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <random>
+
+namespace vecmem::benchmark {
+
+/// The (host) memory resource to use in the benchmark(s).
+static host_memory_resource host_mr;
+/// The thread pool to use in the benchmark(s).
+static thread_pool pool;
+
+/// Create a vector of random integers for the benchmark(s)
+static vector<int> make_input(std::size_t size) {
+
+    vector<int> result(size, &host_mr);
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> dist(-1000000, 1000000);
+    std::generate(result.begin(), result.end(), [&]() { return dist(rng); });
+    return result;
+}
+
+/// Set the custom "counters" of a benchmark processing integers
+static void set_counters(::benchmark::State& state) {
+
+    const std::size_t bytes = state.range(0) * sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+}
+
+/// Function benchmarking @c vecmem::algorithms::reduce
+void algorithmsReduce(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    const auto input_data = get_data(input);
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(algorithms::reduce(pool, input_data, 0l));
+    }
+}
+// Set up the benchmark.
+BENCHMARK(algorithmsReduce)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c std::reduce with a parallel execution policy
+void stdReduce(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(std::reduce(
+            std::execution::par_unseq, input.begin(), input.end(), 0l));
+    }
+}
+// Set up the benchmark.
+BENCHMARK(stdReduce)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c vecmem::algorithms::exclusive_scan
+void algorithmsExclusiveScan(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    vector<int> output(input.size(), &host_mr);
+    const auto input_data = get_data(input);
+    auto output_data = get_data(output);
+    for (auto _ : state) {
+        algorithms::exclusive_scan(pool, input_data, output_data);
+        ::benchmark::ClobberMemory();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(algorithmsExclusiveScan)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c std::exclusive_scan with a parallel policy
+void stdExclusiveScan(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    vector<int> output(input.size(), &host_mr);
+    for (auto _ : state) {
+        std::exclusive_scan(std::execution::par, input.begin(), input.end(),
+                            output.begin(), 0);
+        ::benchmark::ClobberMemory();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(stdExclusiveScan)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c vecmem::algorithms::sort
+void algorithmsSort(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    vector<int> data(input.size(), &host_mr);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), data.begin());
+        state.ResumeTiming();
+        algorithms::sort(pool, get_data(data));
+    }
+}
+// Set up the benchmark.
+BENCHMARK(algorithmsSort)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c std::sort with a parallel execution policy
+void stdSort(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    vector<int> data(input.size(), &host_mr);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), data.begin());
+        state.ResumeTiming();
+        std::sort(std::execution::par, data.begin(), data.end());
+    }
+}
+// Set up the benchmark.
+BENCHMARK(stdSort)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c vecmem::algorithms::copy_if
+void algorithmsCopyIf(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    vector<int> output(input.size(), &host_mr);
+    const auto input_data = get_data(input);
+    auto output_data = get_data(output);
+    for (auto _ : state) {
+        algorithms::copy_if(pool, input_data, output_data,
+                            [](int value) { return value > 0; });
+        ::benchmark::ClobberMemory();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(algorithmsCopyIf)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+/// Function benchmarking @c std::copy_if with a parallel execution policy
+void stdCopyIf(::benchmark::State& state) {
+
+    set_counters(state);
+    const vector<int> input = make_input(state.range(0));
+    vector<int> output(input.size(), &host_mr);
+    for (auto _ : state) {
+        std::copy_if(std::execution::par, input.begin(), input.end(),
+                     output.begin(), [](int value) { return value > 0; });
+        ::benchmark::ClobberMemory();
+    }
+}
+// Set up the benchmark.
+BENCHMARK(stdCopyIf)->Range(1 << 12, 1 << 24)->UseRealTime();
+
+}  // namespace vecmem::benchmark
@@ -0,0 +1,126 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+#include <vecmem/utils/delta_bitpack_codec.hpp>
+#include <vecmem/utils/shuffle_lz_codec.hpp>
+#include <vecmem/utils/thread_pool.hpp>
+
+// Common benchmark include(s).
+#include "../common/throttled_copy.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstdint>
+#include <vector>
+
+namespace vecmem::benchmark {
+
+/// The (host) memory resource to use in the benchmark(s).
+static host_memory_resource codec_mr;
+/// The thread pool to use in the benchmark(s).
+static thread_pool codec_pool;
+/// The codecs to use in the benchmark(s).
+static shuffle_lz_codec lz_codec(sizeof(std::uint32_t));
+static delta_bitpack_codec delta_codec(sizeof(std::uint32_t));
+
+/// Create sorted indices, similar to what the codecs are meant for
+static std::vector<std::uint32_t> make_sorted_indices(std::size_t size) {
+
+    std::vector<std::uint32_t> result(size);
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        value += static_cast<std::uint32_t>((i * 7919) % 13);
+        result[i] = value;
+    }
+    return result;
+}
+
+/// Function benchmarking copies over a bandwidth-limited link
+///
+/// The first argument is the number of elements to copy, the second one is
+/// the bandwidth of the link in MiB/s.
+///
+void vectorThrottledCopy(::benchmark::State& state, const codec* compressor) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(std::uint32_t);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Set up the copy object, with the bandwidth given in MiB/s.
+    throttled_copy copy_obj(static_cast<double>(state.range(1)) * 1024. *
+                            1024.);
+    copy_obj.set_compression({compressor, 0, &codec_mr, &codec_pool});
+
+    // Create the source and destination buffers.
+    const std::vector<std::uint32_t> source = make_sorted_indices(size);
+    data::vector_buffer<std::uint32_t> dest(static_cast<unsigned int>(size),
+                                            codec_mr);
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        copy_obj(data::vector_view<const std::uint32_t>(
+                     static_cast<unsigned int>(size), source.data()),
+                 dest, copy::type::host_to_host);
+    }
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(vectorThrottledCopy, uncompressed, nullptr)
+    ->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {100, 1000, 10000}})
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorThrottledCopy, shuffle_lz, &lz_codec)
+    ->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {100, 1000, 10000}})
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorThrottledCopy, delta_bitpack, &delta_codec)
+    ->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {100, 1000, 10000}})
+    ->UseRealTime();
+
+/// Function benchmarking the compression of sorted indices
+void codecCompress(::benchmark::State& state, const codec& compressor) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(std::uint32_t);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the input and output buffers.
+    const std::vector<std::uint32_t> source = make_sorted_indices(size);
+    std::vector<char> frame(compressor.max_compressed_size(bytes));
+
+    // Perform the compression benchmark.
+    std::size_t frame_size = 0;
+    for (auto _ : state) {
+        frame_size = compressor.compress(source.data(), bytes, frame.data(),
+                                         frame.size(), &codec_pool);
+    }
+    state.counters["Ratio"] =
+        static_cast<double>(bytes) / static_cast<double>(frame_size);
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(codecCompress, shuffle_lz, lz_codec)
+    ->Range(1 << 16, 1 << 24)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(codecCompress, delta_bitpack, delta_codec)
+    ->Range(1 << 16, 1 << 24)
+    ->UseRealTime();
+
+}  // namespace vecmem::benchmark
@@ -1,23 +1,29 @@
 /*
  * VecMem project, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 // VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
 #include <vecmem/memory/host_memory_resource.hpp>
 #include <vecmem/utils/copy.hpp>
+#include <vecmem/utils/host/async_copy.hpp>
+#include <vecmem/utils/parallel_host_copy.hpp>
 
 // Common benchmark include(s).
 #include "../common/make_jagged_sizes.hpp"
 #include "../common/make_jagged_vector.hpp"
+#include "../common/throttled_copy.hpp"
 
 // Google benchmark include(s).
 #include <benchmark/benchmark.h>
 
 // System include(s).
+#include <chrono>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -27,6 +33,20 @@ namespace vecmem::benchmark {
 static host_memory_resource host_mr;
 /// The copy object to use in the benchmark(s).
 static copy host_copy;
+/// The multi-threaded copy object to use in the benchmark(s).
+static parallel_host_copy parallel_copy;
+
+/// Configuration for a single-threaded copy with non-temporal stores
+static parallel_host_copy::config non_temporal_config() {
+    parallel_host_copy::config cfg;
+    cfg.parallel_threshold = std::numeric_limits<std::size_t>::max();
+    cfg.non_temporal_threshold = 0;
+    return cfg;
+}
+/// The non-temporal copy object to use in the benchmark(s).
+static parallel_host_copy non_temporal_copy(1, non_temporal_config());
+/// The asynchronous copy object to use in the benchmark(s).
+static host::async_copy async_host_copy;
 
 /// Function benchmarking "unknown" host-to-device jagged vector copies
 void jaggedVectorUnknownHtoDCopy(::benchmark::State& state) {
@@ -156,4 +176,261 @@ void jaggedVectorKnownDtoHCopy(::benchmark::State& state) {
 // Set up the benchmark.
 BENCHMARK(jaggedVectorKnownDtoHCopy)->Ranges({{10, 100000}, {50, 5000}});
 
+/// Function benchmarking 1-dimensional host-to-host vector copies
+void vectorHtoHCopy(::benchmark::State& state, const copy& copy_obj) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the source and destination buffers.
+    data::vector_buffer<int> source(static_cast<unsigned int>(size), host_mr);
+    copy_obj.memset(source, 1)->wait();
+    data::vector_buffer<int> dest(static_cast<unsigned int>(size), host_mr);
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        copy_obj(source, dest, copy::type::host_to_host)->wait();
+    }
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(vectorHtoHCopy, copy, host_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorHtoHCopy, host_async_copy, async_host_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorHtoHCopy, parallel_host_copy, parallel_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorHtoHCopy, non_temporal, non_temporal_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+
+/// Function benchmarking double-to-float converting host-to-device copies
+void vectorConvertHtoDCopy(::benchmark::State& state) {
+
+    // Set custom "counters" for the benchmark. Counting the bytes that are
+    // transferred, not the ones that are read.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(float);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the source and destination buffers.
+    data::vector_buffer<double> source(static_cast<unsigned int>(size),
+                                       host_mr);
+    host_copy.memset(source, 0);
+    data::vector_buffer<float> dest(static_cast<unsigned int>(size), host_mr);
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        host_copy.convert(data::vector_view<const double>(source),
+                          data::vector_view<float>(dest),
+                          copy::type::host_to_device);
+    }
+}
+// Set up the benchmark.
+BENCHMARK(vectorConvertHtoDCopy)->Range(1 << 10, 1 << 26)->UseRealTime();
+
+/// Function benchmarking pipelined host-to-device copies over a slow link
+///
+/// The first argument is the number of elements to copy, the second one the
+/// number of staging buffers to use. With zero staging buffers the copy is
+/// not staged at all. (Note that the simulated link does not make a
+/// difference between pageable and pinned memory, so it is the comparison
+/// of the different buffer counts that is meaningful.)
+///
+void vectorPipelinedHtoDCopy(::benchmark::State& state) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Set up the copy object, simulating a 4 GiB/s link.
+    throttled_copy copy_obj(4. * 1024 * 1024 * 1024);
+    if (state.range(1) > 0) {
+        copy::staging_config config;
+        config.resource = &host_mr;
+        config.chunk_size = 1024 * 1024;
+        config.n_buffers = static_cast<std::size_t>(state.range(1));
+        copy_obj.set_staging(config);
+    }
+
+    // Create the source and destination buffers.
+    data::vector_buffer<int> source(static_cast<unsigned int>(size), host_mr);
+    host_copy.memset(source, 1);
+    data::vector_buffer<int> dest(static_cast<unsigned int>(size), host_mr);
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        copy_obj(source, dest, copy::type::host_to_device);
+    }
+}
+// Set up the benchmark.
+BENCHMARK(vectorPipelinedHtoDCopy)
+    ->ArgsProduct({{1 << 20, 1 << 24}, {0, 1, 2, 3}})
+    ->UseRealTime();
+
+/// Function benchmarking 1-dimensional vector fills
+void vectorMemset(::benchmark::State& state, const copy& copy_obj) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the buffer to fill.
+    data::vector_buffer<int> buffer(static_cast<unsigned int>(size), host_mr);
+
+    // Perform the fill benchmark.
+    for (auto _ : state) {
+        copy_obj.memset(buffer, 0)->wait();
+    }
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(vectorMemset, copy, host_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorMemset, host_async_copy, async_host_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(vectorMemset, non_temporal, non_temporal_copy)
+    ->Range(1 << 10, 1 << 26)
+    ->UseRealTime();
+
+/// Function benchmarking host copies overlapped with host computation
+///
+/// Every iteration starts a copy, processes an unrelated array of the same
+/// size on the calling thread, and then waits for the copy to finish. With
+/// an asynchronous copy object the two should overlap.
+///
+void overlappedHtoHCopy(::benchmark::State& state, const copy& copy_obj) {
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t bytes = size * sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the source and destination buffers, and the array to process.
+    data::vector_buffer<int> source(static_cast<unsigned int>(size), host_mr);
+    copy_obj.memset(source, 1)->wait();
+    data::vector_buffer<int> dest(static_cast<unsigned int>(size), host_mr);
+    std::vector<int> work(size, 1);
+
+    // Perform the benchmark.
+    for (auto _ : state) {
+        copy::event_type event =
+            copy_obj(source, dest, copy::type::host_to_host);
+        for (int& value : work) {
+            value = value * 3 + 1;
+        }
+        ::benchmark::DoNotOptimize(work.data());
+        event->wait();
+    }
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(overlappedHtoHCopy, copy, host_copy)
+    ->Range(1 << 16, 1 << 26)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(overlappedHtoHCopy, host_async_copy, async_host_copy)
+    ->Range(1 << 16, 1 << 26)
+    ->UseRealTime();
+
+/// Function benchmarking the cache effects of large copies
+///
+/// It measures how long it takes to read a small, "hot" array after a large
+/// copy. Copies using regular stores evict the hot array from the caches,
+/// while copies using non-temporal stores should not.
+///
+void hotReadAfterCopy(::benchmark::State& state, const copy& copy_obj) {
+
+    // Create the source and destination buffers of the copy.
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    data::vector_buffer<int> source(static_cast<unsigned int>(size), host_mr);
+    copy_obj.memset(source, 1);
+    data::vector_buffer<int> dest(static_cast<unsigned int>(size), host_mr);
+
+    // Create the "hot" array.
+    static constexpr std::size_t HOT_SIZE = 128 * 1024;
+    std::vector<int> hot(HOT_SIZE, 1);
+
+    // Perform the benchmark, only measuring the time needed to read the hot
+    // array.
+    for (auto _ : state) {
+        copy_obj(source, dest, copy::type::host_to_host);
+        const auto start = std::chrono::high_resolution_clock::now();
+        int sum = std::accumulate(hot.begin(), hot.end(), 0);
+        ::benchmark::DoNotOptimize(sum);
+        const auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(
+            std::chrono::duration<double>(end - start).count());
+    }
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(hotReadAfterCopy, copy, host_copy)
+    ->Range(1 << 20, 1 << 26)
+    ->UseManualTime();
+BENCHMARK_CAPTURE(hotReadAfterCopy, non_temporal, non_temporal_copy)
+    ->Range(1 << 20, 1 << 26)
+    ->UseManualTime();
+
+/// Function benchmarking host-to-host jagged vector copies
+void jaggedVectorHtoHCopy(::benchmark::State& state, const copy& copy_obj) {
+
+    // Generate the sizes of the jagged vector/buffer for the test.
+    const std::vector<std::size_t> sizes =
+        make_jagged_sizes(state.range(0), state.range(1));
+
+    // Set custom "counters" for the benchmark.
+    const std::size_t bytes = std::accumulate(sizes.begin(), sizes.end(),
+                                              static_cast<std::size_t>(0u)) *
+                              sizeof(int);
+    state.counters["Bytes"] = static_cast<double>(bytes);
+    state.counters["Rate"] =
+        ::benchmark::Counter(static_cast<double>(bytes),
+                             ::benchmark::Counter::kIsIterationInvariantRate,
+                             ::benchmark::Counter::kIs1024);
+
+    // Create the "source vector".
+    jagged_vector<int> source = make_jagged_vector(sizes, host_mr);
+    const data::jagged_vector_data<int> source_data = get_data(source);
+    // Create the "destination buffer".
+    data::jagged_vector_buffer<int> dest(sizes, host_mr);
+    copy_obj.setup(dest);
+
+    // Perform the copy benchmark.
+    for (auto _ : state) {
+        copy_obj(source_data, dest, copy::type::host_to_host);
+    }
+}
+// Set up the benchmarks.
+BENCHMARK_CAPTURE(jaggedVectorHtoHCopy, copy, host_copy)
+    ->Ranges({{10, 100000}, {50, 50000}})
+    ->UseRealTime();
+BENCHMARK_CAPTURE(jaggedVectorHtoHCopy, parallel_host_copy, parallel_copy)
+    ->Ranges({{10, 100000}, {50, 50000}})
+    ->UseRealTime();
+
 }  // namespace vecmem::benchmark
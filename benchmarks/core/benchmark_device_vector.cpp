@@ -0,0 +1,120 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <memory>
+
+// The benchmarks need vecmem::device_atomic_ref to be a real atomic on the
+// host, which it only is with std::atomic_ref available.
+#ifndef __cpp_lib_atomic_ref
+#error "The device vector benchmarks need std::atomic_ref"
+#endif
+
+namespace vecmem::benchmark {
+
+/// The (host) memory resource to use in the benchmark(s).
+static host_memory_resource host_mr;
+/// The copy object to use in the benchmark(s).
+static copy host_copy;
+
+/// The number of iterations that every thread performs
+static constexpr ::benchmark::IterationCount ITERATIONS = 2000;
+
+/// The buffer that all threads of a benchmark append to
+static std::unique_ptr<data::vector_buffer<int> > shared_buffer;
+
+/// Set up the shared buffer for a benchmark, from its first thread
+static void setup_buffer(const ::benchmark::State& state) {
+
+    if (state.thread_index() != 0) {
+        return;
+    }
+    const auto capacity = static_cast<unsigned int>(
+        state.threads() * state.max_iterations * state.range(0));
+    shared_buffer =
+        std::make_unique<data::vector_buffer<int> >(capacity, 0u, host_mr);
+    host_copy.setup(*shared_buffer)->wait();
+}
+
+/// Tear down the shared buffer of a benchmark, from its first thread
+static void teardown_buffer(::benchmark::State& state) {
+
+    if (state.thread_index() != 0) {
+        return;
+    }
+    if (shared_buffer->size() != shared_buffer->capacity()) {
+        state.SkipWithError("Unexpected number of appended elements");
+    }
+    shared_buffer.reset();
+}
+
+/// Function benchmarking element-by-element appends from many threads
+void deviceVectorPushBack(::benchmark::State& state) {
+
+    // Set up the shared buffer.
+    setup_buffer(state);
+
+    // Perform the benchmark.
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        device_vector<int> vec(*shared_buffer);
+        for (int i = 0; i < n; ++i) {
+            vec.push_back(i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+
+    // Check and clean up the shared buffer.
+    teardown_buffer(state);
+}
+// Set up the benchmark.
+BENCHMARK(deviceVectorPushBack)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Iterations(ITERATIONS)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+/// Function benchmarking bulk appends from many threads
+void deviceVectorBulkAppend(::benchmark::State& state) {
+
+    // Set up the shared buffer.
+    setup_buffer(state);
+
+    // Perform the benchmark.
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        device_vector<int> vec(*shared_buffer);
+        const auto index = vec.bulk_append(static_cast<unsigned int>(n));
+        for (int i = 0; i < n; ++i) {
+            vec[index + i] = i;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+
+    // Check and clean up the shared buffer.
+    teardown_buffer(state);
+}
+// Set up the benchmark.
+BENCHMARK(deviceVectorBulkAppend)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Iterations(ITERATIONS)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace vecmem::benchmark
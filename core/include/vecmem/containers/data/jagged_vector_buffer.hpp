@@ -9,8 +9,10 @@
 
 // Local include(s).
 #include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/memory/unique_ptr.hpp"
+#include "vecmem/utils/thread_pool.hpp"
 
 // System include(s).
 #include <cstddef>
@@ -87,6 +89,31 @@ public:
                          memory_resource& resource,
                          memory_resource* host_access_resource = nullptr);
 
+    /// Constructor from a view of ("inner vector") sizes
+    ///
+    /// Meant for setting up a buffer for rows that were counted by a
+    /// previous, parallel processing step. The offsets of the rows are
+    /// calculated with a prefix sum over the sizes, which is spread over the
+    /// threads of @c pool if one is provided. Only the total of the sizes
+    /// is used to allocate memory for the "inner vectors", all of which are
+    /// placed right after each other.
+    ///
+    /// @param sizes View of the sizes of the "inner vectors". It must be
+    ///        host accessible.
+    /// @param resource The device accessible memory resource, which may also
+    ///        be host accessible.
+    /// @param host_access_resource An optional host accessible memory
+    ///        resource. Needed if @c resource is not host accessible.
+    /// @param pool An optional thread pool to calculate the layout with
+    template <typename SIZE_TYPE,
+              std::enable_if_t<std::is_integral<SIZE_TYPE>::value &&
+                                   std::is_unsigned<SIZE_TYPE>::value,
+                               bool> = true>
+    jagged_vector_buffer(const vector_view<SIZE_TYPE>& sizes,
+                         memory_resource& resource,
+                         memory_resource* host_access_resource = nullptr,
+                         thread_pool* pool = nullptr);
+
     /// Constructor from a vector of ("inner vector") sizes and capacities
     ///
     /// @param sizes Simple vector holding the sizes of the "inner vectors"
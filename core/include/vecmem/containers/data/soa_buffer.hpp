@@ -0,0 +1,84 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/soa_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/unique_ptr.hpp"
+#include "vecmem/utils/type_traits.hpp"
+
+// System include(s).
+#include <type_traits>
+
+namespace vecmem {
+namespace data {
+
+/// Object owning the memory of a "struct-of-arrays" collection
+///
+/// The size variable (for resizable buffers) and all of the columns of the
+/// collection are placed into a single memory allocation. So that the whole
+/// collection could be allocated, set up and copied with as few operations
+/// as possible.
+///
+template <typename... TYPES>
+class soa_buffer : public soa_view<TYPES...> {
+
+public:
+    /// The base type used by this class
+    typedef soa_view<TYPES...> base_type;
+    /// Size type definition coming from the base class
+    typedef typename base_type::size_type size_type;
+    /// Size pointer type definition coming from the base class
+    typedef typename base_type::size_pointer size_pointer;
+    /// Pointers type definition coming from the base class
+    typedef typename base_type::pointers pointers;
+
+    /// @name Checks on the types of the columns
+    /// @{
+
+    /// Make sure that the column types do not have custom destructors
+    static_assert(
+        details::conjunction_v<std::is_trivially_destructible<TYPES>...>,
+        "vecmem::data::soa_buffer can not handle types with custom "
+        "destructors");
+
+    /// @}
+
+    /// Default constructor
+    soa_buffer();
+    /// Constant size data constructor
+    soa_buffer(size_type size, memory_resource& resource);
+    /// Resizable data constructor
+    soa_buffer(size_type capacity, size_type size, memory_resource& resource);
+    /// Move constructor
+    soa_buffer(soa_buffer&&) = default;
+
+    /// Move assignment
+    soa_buffer& operator=(soa_buffer&&) = default;
+
+private:
+    /// Data object owning the allocated memory
+    vecmem::unique_alloc_ptr<char[]> m_memory;
+
+};  // class soa_buffer
+
+}  // namespace data
+
+/// Helper function for getting a @c vecmem::data::soa_view from a buffer
+template <typename... TYPES>
+data::soa_view<TYPES...>& get_data(data::soa_buffer<TYPES...>& data);
+
+/// Helper function for getting a @c vecmem::data::soa_view from a buffer
+template <typename... TYPES>
+const data::soa_view<TYPES...>& get_data(
+    const data::soa_buffer<TYPES...>& data);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/soa_buffer.ipp"
@@ -0,0 +1,133 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/details/soa_pointers.hpp"
+#include "vecmem/utils/type_traits.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+
+namespace vecmem {
+namespace data {
+
+/// Class holding data about a "struct-of-arrays" collection
+///
+/// The collection is made of one array (column) per member type, all of them
+/// with the same capacity, and sharing a single size variable. Just like
+/// @c vecmem::data::vector_view, the collection can either have a fixed size,
+/// or be resizable.
+///
+/// This type does not own the data that it points to. It merely provides a
+/// "view" of that data.
+///
+template <typename... TYPES>
+class soa_view {
+
+    // Let the other specialisations access the internals of this one.
+    template <typename... OTHERTYPES>
+    friend class soa_view;
+
+public:
+    /// Make sure that there is at least one column in the collection
+    static_assert(sizeof...(TYPES) > 0,
+                  "vecmem::data::soa_view needs at least one column");
+
+    /// Size type used in the class
+    typedef unsigned int size_type;
+    /// Pointer type to the size of the collection
+    typedef typename std::conditional<
+        details::conjunction_v<std::is_const<TYPES>...>, const size_type*,
+        size_type*>::type size_pointer;
+    /// Constant pointer type to the size of the collection
+    typedef const typename std::remove_const<size_pointer>::type
+        const_size_pointer;
+    /// Type holding the pointers to the columns
+    typedef details::soa_pointers<TYPES...> pointers;
+
+    /// Type of the I-th column's elements
+    template <std::size_t I>
+    using element_type = details::soa_element_t<I, TYPES...>;
+
+    /// Number of columns in the collection
+    static constexpr std::size_t n_columns = sizeof...(TYPES);
+
+    /// Default constructor
+    soa_view() = default;
+    /// Constant size data constructor
+    VECMEM_HOST_AND_DEVICE
+    soa_view(size_type size, const pointers& ptrs);
+    /// Resizable data constructor
+    VECMEM_HOST_AND_DEVICE
+    soa_view(size_type capacity, size_pointer size, const pointers& ptrs);
+
+    /// Constructor from a "slightly different" @c vecmem::data::soa_view
+    /// object
+    ///
+    /// Only enabled if the column types differ, but only by const-ness.
+    ///
+    template <typename... OTHERTYPES,
+              std::enable_if_t<
+                  (sizeof...(OTHERTYPES) == sizeof...(TYPES)) &&
+                      details::conjunction_v<
+                          std::is_convertible<OTHERTYPES*, TYPES*>...> &&
+                      (!std::is_same<soa_view<OTHERTYPES...>, soa_view>::value),
+                  bool> = true>
+    VECMEM_HOST_AND_DEVICE soa_view(const soa_view<OTHERTYPES...>& parent);
+
+    /// Equality check. Two objects are only equal if they point at the same
+    /// memory.
+    VECMEM_HOST_AND_DEVICE
+    bool operator==(const soa_view& rhs) const;
+    /// Inequality check. Simply based on @c operator==.
+    VECMEM_HOST_AND_DEVICE
+    bool operator!=(const soa_view& rhs) const;
+
+    /// Get the size of the collection
+    VECMEM_HOST_AND_DEVICE
+    size_type size() const;
+    /// Get the maximum capacity of the collection
+    VECMEM_HOST_AND_DEVICE
+    size_type capacity() const;
+
+    /// Get a pointer to the size of the collection (non-const)
+    VECMEM_HOST_AND_DEVICE
+    size_pointer size_ptr();
+    /// Get a pointer to the size of the collection (const)
+    VECMEM_HOST_AND_DEVICE
+    const_size_pointer size_ptr() const;
+
+    /// Get the pointers to all of the columns
+    VECMEM_HOST_AND_DEVICE
+    const pointers& ptrs() const;
+    /// Get a pointer to the I-th column
+    template <std::size_t I>
+    VECMEM_HOST_AND_DEVICE element_type<I>* ptr() const;
+
+    /// Get a view of the I-th column, sharing the size of the collection
+    template <std::size_t I>
+    VECMEM_HOST_AND_DEVICE vector_view<element_type<I> > column() const;
+
+protected:
+    /// Maximum capacity of the collection
+    size_type m_capacity;
+    /// Pointer to the size of the collection in memory
+    size_pointer m_size;
+    /// Pointers to the start of the columns
+    pointers m_ptrs;
+
+};  // class soa_view
+
+}  // namespace data
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/soa_view.ipp"
@@ -0,0 +1,105 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace vecmem {
+namespace details {
+
+/// The smallest number of elements handed to a single thread
+static constexpr std::size_t parallel_scan_min_block = 16384;
+
+/// Get the number of blocks to split a range of a given length into
+inline std::size_t parallel_scan_blocks(std::size_t n, thread_pool* pool) {
+
+    if (pool == nullptr) {
+        return 1;
+    }
+    const std::size_t max_blocks =
+        (n + parallel_scan_min_block - 1) / parallel_scan_min_block;
+    return std::max<std::size_t>(std::min(pool->size() + 1, max_blocks), 1);
+}
+
+/// Execute a function on contiguous blocks of a range, possibly in parallel
+///
+/// @param n The length of the range
+/// @param n_blocks The number of blocks to split the range into
+/// @param pool The thread pool to use, if @c n_blocks is larger than one
+/// @param func The function to call with the index, and the first and last
+///        (exclusive) element of each block
+///
+template <typename FUNC>
+void parallel_scan_for_blocks(std::size_t n, std::size_t n_blocks,
+                              thread_pool* pool, const FUNC& func) {
+
+    if (n_blocks <= 1) {
+        func(0, 0, n);
+        return;
+    }
+    const std::size_t block_size = (n + n_blocks - 1) / n_blocks;
+    pool->parallel_for(n_blocks, [&](std::size_t block) {
+        const std::size_t begin = std::min(block * block_size, n);
+        const std::size_t end = std::min(begin + block_size, n);
+        func(block, begin, end);
+    });
+}
+
+/// Calculate the exclusive prefix sum of an array of sizes
+///
+/// The sum is calculated in two passes over contiguous blocks of the input,
+/// the first one summing up the sizes in every block, and the second one
+/// writing the offsets of the block's elements.
+///
+/// @param sizes The sizes to sum up
+/// @param n The number of sizes
+/// @param offsets The output array, with @c n+1 elements. Its last element
+///        receives the sum of all of the sizes.
+/// @param pool Thread pool to spread the calculation over (optional)
+///
+template <typename SIZE_TYPE>
+void exclusive_scan_sizes(const SIZE_TYPE* sizes, std::size_t n,
+                          std::size_t* offsets, thread_pool* pool = nullptr) {
+
+    // The sums of the sizes in the blocks, turned into the offsets of the
+    // blocks.
+    const std::size_t n_blocks = parallel_scan_blocks(n, pool);
+    std::vector<std::size_t> block_offsets(n_blocks + 1, 0);
+    if (n_blocks > 1) {
+        parallel_scan_for_blocks(
+            n, n_blocks, pool,
+            [&](std::size_t block, std::size_t begin, std::size_t end) {
+                block_offsets[block + 1] =
+                    std::accumulate(sizes + begin, sizes + end,
+                                    static_cast<std::size_t>(0));
+            });
+        std::partial_sum(block_offsets.begin(), block_offsets.end(),
+                         block_offsets.begin());
+    }
+
+    // Write the offsets of the elements.
+    parallel_scan_for_blocks(
+        n, n_blocks, pool,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            std::size_t offset = block_offsets[block];
+            for (std::size_t i = begin; i < end; ++i) {
+                offsets[i] = offset;
+                offset += sizes[i];
+            }
+        });
+    offsets[n] = (n == 0 ? 0 : offsets[n - 1] + sizes[n - 1]);
+}
+
+}  // namespace details
+}  // namespace vecmem
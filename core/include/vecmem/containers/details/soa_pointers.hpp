@@ -0,0 +1,125 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace vecmem {
+namespace details {
+
+/// Type of the I-th element in a list of types
+template <std::size_t I, typename... TYPES>
+using soa_element_t = std::tuple_element_t<I, std::tuple<TYPES...> >;
+
+/// Collection of pointers to the columns of a struct-of-arrays container
+///
+/// It is a simple, recursively defined type instead of an @c std::tuple, so
+/// that it would be trivially copyable, and usable in device code without any
+/// special compiler flags.
+///
+template <typename... TYPES>
+struct soa_pointers;
+
+/// Specialisation for an empty list of columns, terminating the recursion
+template <>
+struct soa_pointers<> {
+
+    /// Default constructor
+    soa_pointers() = default;
+
+    /// Equality check
+    VECMEM_HOST_AND_DEVICE
+    bool operator==(const soa_pointers&) const { return true; }
+
+};  // struct soa_pointers
+
+/// Specialisation holding the pointer to the first column, and the pointers
+/// to the rest of the columns recursively
+template <typename TYPE, typename... TYPES>
+struct soa_pointers<TYPE, TYPES...> {
+
+    /// Default constructor
+    soa_pointers() = default;
+    /// Constructor from the column pointers
+    VECMEM_HOST_AND_DEVICE
+    soa_pointers(TYPE* head, TYPES*... tail) : m_head(head), m_tail(tail...) {}
+    /// Constructor from pointers to (possibly) non-const columns
+    template <
+        typename OTHERTYPE, typename... OTHERTYPES,
+        std::enable_if_t<!std::is_same<soa_pointers<OTHERTYPE, OTHERTYPES...>,
+                                       soa_pointers>::value,
+                         bool> = true>
+    VECMEM_HOST_AND_DEVICE soa_pointers(
+        const soa_pointers<OTHERTYPE, OTHERTYPES...>& parent)
+        : m_head(parent.m_head), m_tail(parent.m_tail) {}
+
+    /// Get the pointer to the I-th column
+    template <std::size_t I>
+    VECMEM_HOST_AND_DEVICE soa_element_t<I, TYPE, TYPES...>* get() const {
+        if constexpr (I == 0) {
+            return m_head;
+        } else {
+            return m_tail.template get<I - 1>();
+        }
+    }
+
+    /// Equality check
+    VECMEM_HOST_AND_DEVICE
+    bool operator==(const soa_pointers& rhs) const {
+        return ((m_head == rhs.m_head) && (m_tail == rhs.m_tail));
+    }
+
+    /// Pointer to the first column
+    TYPE* m_head;
+    /// Pointers to the rest of the columns
+    soa_pointers<TYPES...> m_tail;
+
+};  // struct soa_pointers
+
+/// Proxy for one element of a struct-of-arrays container
+///
+/// It gives access to the "members" of a single element, which are stored in
+/// the different columns of the container.
+///
+template <typename... TYPES>
+class soa_reference {
+
+public:
+    /// Size type used in the class
+    typedef unsigned int size_type;
+
+    /// Constructor from the column pointers and the element index
+    VECMEM_HOST_AND_DEVICE
+    soa_reference(const soa_pointers<TYPES...>& ptrs, size_type index)
+        : m_ptrs(ptrs), m_index(index) {}
+
+    /// Access the I-th member of the element
+    template <std::size_t I>
+    VECMEM_HOST_AND_DEVICE soa_element_t<I, TYPES...>& get() const {
+        return m_ptrs.template get<I>()[m_index];
+    }
+
+    /// Get the index of the element in its container
+    VECMEM_HOST_AND_DEVICE
+    size_type index() const { return m_index; }
+
+private:
+    /// Pointers to the columns of the container
+    soa_pointers<TYPES...> m_ptrs;
+    /// Index of the element in the container
+    size_type m_index;
+
+};  // class soa_reference
+
+}  // namespace details
+}  // namespace vecmem
@@ -152,13 +152,57 @@ public:
     }
 
     /// Add a new element at the end of the vector (thread-safe)
+    ///
+    /// Since it has to return a reference to the new element, this function
+    /// must not be called on a full vector. Use @c push_back where the vector
+    /// may overflow.
+    ///
     template <typename... Args>
     VECMEM_HOST_AND_DEVICE reference emplace_back(Args&&... args);
     /// Add a new element at the end of the vector (thread-safe)
+    ///
+    /// If the vector is already full, the element is not added, but the size
+    /// of the vector still counts it. See @c overflowed().
+    ///
+    /// @return The index under which the element was inserted, which is not
+    ///         smaller than @c capacity() for elements that did not fit
+    ///
     VECMEM_HOST_AND_DEVICE
     size_type push_back(const_reference value);
 
+    /// Reserve a number of elements at the end of the vector (thread-safe)
+    ///
+    /// All of the slots are claimed with a single atomic operation on the
+    /// size of the vector, which makes it much cheaper than calling
+    /// @c push_back for every element, when many threads append to the same
+    /// vector. The claimed elements are left uninitialized, they need to be
+    /// filled by the caller through the returned index.
+    ///
+    /// Only the claimed elements with an index smaller than @c capacity()
+    /// may be filled. The size of the vector counts all of them either way.
+    ///
+    /// @param n The number of elements to reserve
+    /// @return The index of the first reserved element
+    ///
+    VECMEM_HOST_AND_DEVICE
+    size_type bulk_append(size_type n);
+    /// Add a number of copies of an element at the end of the vector
+    /// (thread-safe)
+    ///
+    /// Only the elements that fit into the vector are constructed.
+    ///
+    /// @param n The number of elements to add
+    /// @param value The value to fill the new elements with
+    /// @return The index of the first added element
+    ///
+    VECMEM_HOST_AND_DEVICE
+    size_type bulk_append(size_type n, const_reference value);
+
     /// Remove the last element of the vector (not thread-safe)
+    ///
+    /// On an overflowed vector this only decrements the requested size,
+    /// until it drops back to @c capacity().
+    ///
     VECMEM_HOST_AND_DEVICE
     size_type pop_back();
 
@@ -240,6 +284,18 @@ public:
     VECMEM_HOST_AND_DEVICE
     size_type capacity() const;
 
+    /// Return the number of elements requested to be in the vector
+    ///
+    /// It can be larger than @c capacity(), if more elements were added to
+    /// the vector than what it could hold.
+    ///
+    VECMEM_HOST_AND_DEVICE
+    size_type requested_size() const;
+    /// Check whether more elements were added to the vector than it could
+    /// hold
+    VECMEM_HOST_AND_DEVICE
+    bool overflowed() const;
+
     /// @}
 
 private:
@@ -0,0 +1,139 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/type_traits.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+namespace vecmem {
+
+/// Host jagged vector storing all of its elements in a single array
+///
+/// Unlike @c vecmem::jagged_vector, which allocates every "inner vector"
+/// separately, this container stores its elements in a compressed sparse row
+/// (CSR) layout. With one array holding all of the elements, and another one
+/// holding the offsets of the rows in it. The views created for it are
+/// always contiguous, so they can be copied with a single operation.
+///
+/// The container can only be grown by adding new rows to it, or elements to
+/// its last row.
+///
+template <typename TYPE>
+class flat_jagged_vector {
+
+public:
+    /// @name Type definitions
+    /// @{
+
+    /// Type of the elements
+    typedef TYPE value_type;
+    /// Size type for the container
+    typedef typename data::vector_view<TYPE>::size_type size_type;
+    /// Type used for accessing one row of the container
+    typedef device_vector<TYPE> row_type;
+    /// Type used for accessing one row of the container (const)
+    typedef device_vector<const TYPE> const_row_type;
+
+    /// @}
+
+    /// Constructor with a memory resource
+    flat_jagged_vector(memory_resource& resource);
+    /// Constructor with the sizes of the rows, and a memory resource
+    flat_jagged_vector(const std::vector<size_type>& sizes,
+                       memory_resource& resource);
+
+    /// @name Element access functions
+    /// @{
+
+    /// Access one row of the container (non-const)
+    row_type operator[](size_type row);
+    /// Access one row of the container (const)
+    const_row_type operator[](size_type row) const;
+
+    /// Access the array holding all of the elements (non-const)
+    vector<TYPE>& values();
+    /// Access the array holding all of the elements (const)
+    const vector<TYPE>& values() const;
+    /// Access the offsets of the rows in the element array
+    ///
+    /// It holds one more element than the number of rows, with the last
+    /// element being the total number of elements in the container.
+    ///
+    const vector<size_type>& offsets() const;
+
+    /// @}
+
+    /// @name Payload modification functions
+    /// @{
+
+    /// Add a new row to the container
+    template <
+        typename InputIt,
+        std::enable_if_t<details::is_iterator_of<InputIt, value_type>::value,
+                         bool> = true>
+    void push_back(InputIt begin, InputIt end);
+    /// Add a new row to the container
+    void push_back(std::initializer_list<value_type> row);
+    /// Add a new, empty row to the container
+    void add_row();
+    /// Add an element to the last row of the container
+    void add_to_last_row(const value_type& value);
+
+    /// Set up the container with rows of the given sizes
+    void resize(const std::vector<size_type>& sizes);
+    /// Reserve memory for a given number of rows and elements
+    void reserve(size_type rows, size_type elements);
+    /// Remove all rows from the container
+    void clear();
+
+    /// @}
+
+    /// @name Capacity checking functions
+    /// @{
+
+    /// Check whether the container has no rows
+    bool empty() const;
+    /// Return the number of rows in the container
+    size_type size() const;
+    /// Return the total number of elements in the container
+    size_type total_size() const;
+
+    /// @}
+
+private:
+    /// Offsets of the rows in the element array
+    vector<size_type> m_offsets;
+    /// All elements of the container
+    vector<TYPE> m_values;
+
+};  // class flat_jagged_vector
+
+/// Helper function creating a @c vecmem::data::jagged_vector_data object
+template <typename TYPE>
+VECMEM_HOST data::jagged_vector_data<TYPE> get_data(
+    flat_jagged_vector<TYPE>& vec, memory_resource* resource = nullptr);
+
+/// Helper function creating a @c vecmem::data::jagged_vector_data object
+template <typename TYPE>
+VECMEM_HOST data::jagged_vector_data<const TYPE> get_data(
+    const flat_jagged_vector<TYPE>& vec, memory_resource* resource = nullptr);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/flat_jagged_vector.ipp"
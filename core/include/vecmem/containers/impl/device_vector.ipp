@@ -216,12 +216,46 @@ VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::push_back(
     // index from other threads.
     device_atomic_ref<size_type> asize(*m_size);
     const size_type index = asize.fetch_add(1);
-    assert(index < m_capacity);
 
-    // Instantiate the new value.
-    construct(index, value);
+    // Only instantiate the new value if it fits into the vector. The size of
+    // the vector keeps counting the requested elements either way.
+    if (index < m_capacity) {
+        construct(index, value);
+    }
+
+    // Return the index under which the element was (or would have been)
+    // inserted.
+    return index;
+}
+
+template <typename TYPE>
+VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::bulk_append(size_type n)
+    -> size_type {
+
+    // This can only be done on a resizable vector.
+    assert(m_size != nullptr);
+
+    // Claim all of the requested elements from other threads in one go.
+    device_atomic_ref<size_type> asize(*m_size);
+    const size_type index = asize.fetch_add(n);
+
+    // Return the index of the first claimed element.
+    return index;
+}
+
+template <typename TYPE>
+VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::bulk_append(
+    size_type n, const_reference value) -> size_type {
 
-    // Return the index under which the element was inserted:
+    // Claim the elements.
+    const size_type index = bulk_append(n);
+
+    // Instantiate the new values that fit into the vector.
+    for (size_type i = index; (i < index + n) && (i < m_capacity); ++i) {
+        construct(i, value);
+    }
+
+    // Return the index of the first added element.
     return index;
 }
 
@@ -235,8 +269,11 @@ VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::pop_back() -> size_type {
     device_atomic_ref<size_type> asize(*m_size);
     const size_type new_size = asize.fetch_sub(1) - 1;
 
-    // Remove the last element.
-    destruct(new_size);
+    // Remove the last element. Unless it never made it into an overflowed
+    // vector.
+    if (new_size < m_capacity) {
+        destruct(new_size);
+    }
 
     // Return the vector's new size to the user.
     return new_size;
@@ -249,8 +286,8 @@ VECMEM_HOST_AND_DEVICE void device_vector<TYPE>::clear() {
     assert(m_size != nullptr);
 
     // Destruct all of the elements that the vector has "at the moment".
+    const size_type current_size = size();
     device_atomic_ref<size_type> asize(*m_size);
-    const size_type current_size = asize.load();
     for (size_type i = 0; i < current_size; ++i) {
         destruct(i);
     }
@@ -273,11 +310,11 @@ VECMEM_HOST_AND_DEVICE void device_vector<TYPE>::resize(size_type new_size,
     assert(m_size != nullptr);
 
     // Get the current size of the vector.
+    const size_type current_size = size();
     device_atomic_ref<size_type> asize(*m_size);
-    const size_type current_size = asize.load();
 
     // Check if anything needs to be done.
-    if (new_size == current_size) {
+    if (new_size == asize.load()) {
         return;
     }
 
@@ -395,11 +432,32 @@ VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::size() const -> size_type {
         // SYCL we must pass a non-const pointer to the sycl::atomic object
         // that performs the load operation. And for that we need a non-const
         // pointer...
+        device_atomic_ref<size_type> asize(*(const_cast<size_type*>(m_size)));
+        // The size variable may be larger than the capacity, if more elements
+        // were requested than what fits into the vector.
+        const size_type size = asize.load();
+        return (size < m_capacity ? size : m_capacity);
+    }
+}
+
+template <typename TYPE>
+VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::requested_size() const
+    -> size_type {
+
+    if (m_size == nullptr) {
+        return m_capacity;
+    } else {
         device_atomic_ref<size_type> asize(*(const_cast<size_type*>(m_size)));
         return asize.load();
     }
 }
 
+template <typename TYPE>
+VECMEM_HOST_AND_DEVICE bool device_vector<TYPE>::overflowed() const {
+
+    return (requested_size() > m_capacity);
+}
+
 template <typename TYPE>
 VECMEM_HOST_AND_DEVICE auto device_vector<TYPE>::max_size() const -> size_type {
 
@@ -0,0 +1,198 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+
+namespace vecmem {
+
+template <typename TYPE>
+flat_jagged_vector<TYPE>::flat_jagged_vector(memory_resource& resource)
+    : m_offsets(1, 0, &resource), m_values(&resource) {}
+
+template <typename TYPE>
+flat_jagged_vector<TYPE>::flat_jagged_vector(
+    const std::vector<size_type>& sizes, memory_resource& resource)
+    : flat_jagged_vector(resource) {
+
+    resize(sizes);
+}
+
+template <typename TYPE>
+auto flat_jagged_vector<TYPE>::operator[](size_type row) -> row_type {
+
+    // Check if the index is valid.
+    assert(row < size());
+
+    // Return a vector for the requested row.
+    return row_type({m_offsets[row + 1] - m_offsets[row],
+                     m_values.data() + m_offsets[row]});
+}
+
+template <typename TYPE>
+auto flat_jagged_vector<TYPE>::operator[](size_type row) const
+    -> const_row_type {
+
+    // Check if the index is valid.
+    assert(row < size());
+
+    // Return a vector for the requested row.
+    return const_row_type({m_offsets[row + 1] - m_offsets[row],
+                           m_values.data() + m_offsets[row]});
+}
+
+template <typename TYPE>
+vector<TYPE>& flat_jagged_vector<TYPE>::values() {
+
+    return m_values;
+}
+
+template <typename TYPE>
+const vector<TYPE>& flat_jagged_vector<TYPE>::values() const {
+
+    return m_values;
+}
+
+template <typename TYPE>
+auto flat_jagged_vector<TYPE>::offsets() const -> const vector<size_type>& {
+
+    return m_offsets;
+}
+
+template <typename TYPE>
+template <
+    typename InputIt,
+    std::enable_if_t<details::is_iterator_of<InputIt, TYPE>::value, bool> >
+void flat_jagged_vector<TYPE>::push_back(InputIt begin, InputIt end) {
+
+    m_values.insert(m_values.end(), begin, end);
+    m_offsets.push_back(static_cast<size_type>(m_values.size()));
+}
+
+template <typename TYPE>
+void flat_jagged_vector<TYPE>::push_back(std::initializer_list<TYPE> row) {
+
+    push_back(row.begin(), row.end());
+}
+
+template <typename TYPE>
+void flat_jagged_vector<TYPE>::add_row() {
+
+    m_offsets.push_back(m_offsets.back());
+}
+
+template <typename TYPE>
+void flat_jagged_vector<TYPE>::add_to_last_row(const value_type& value) {
+
+    // There must be a row to add the element to.
+    assert(!empty());
+
+    m_values.push_back(value);
+    ++(m_offsets.back());
+}
+
+template <typename TYPE>
+void flat_jagged_vector<TYPE>::resize(const std::vector<size_type>& sizes) {
+
+    // Set up the offsets of the rows.
+    m_offsets.resize(sizes.size() + 1);
+    m_offsets[0] = 0;
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        m_offsets[i + 1] = m_offsets[i] + sizes[i];
+    }
+
+    // Set up the element array.
+    m_values.resize(m_offsets.back());
+}
+
+template <typename TYPE>
+void flat_jagged_vector<TYPE>::reserve(size_type rows, size_type elements) {
+
+    m_offsets.reserve(rows + 1);
+    m_values.reserve(elements);
+}
+
+template <typename TYPE>
+void flat_jagged_vector<TYPE>::clear() {
+
+    m_offsets.resize(1);
+    m_values.clear();
+}
+
+template <typename TYPE>
+bool flat_jagged_vector<TYPE>::empty() const {
+
+    return (size() == 0);
+}
+
+template <typename TYPE>
+auto flat_jagged_vector<TYPE>::size() const -> size_type {
+
+    return static_cast<size_type>(m_offsets.size() - 1);
+}
+
+template <typename TYPE>
+auto flat_jagged_vector<TYPE>::total_size() const -> size_type {
+
+    return m_offsets.back();
+}
+
+template <typename TYPE>
+data::jagged_vector_data<TYPE> get_data(flat_jagged_vector<TYPE>& vec,
+                                        memory_resource* resource) {
+
+    // Construct the object to be returned.
+    const auto size = vec.size();
+    memory_resource& mr = (resource != nullptr
+                               ? *resource
+                               : *(vec.values().get_allocator().resource()));
+    data::jagged_vector_data<TYPE> result(size, mr);
+
+    // Helper local type definition(s).
+    typedef typename data::jagged_vector_data<TYPE>::value_type value_type;
+
+    // Fill the result object with information. All rows are placed right
+    // after each other in memory.
+    const auto& offsets = vec.offsets();
+    for (std::size_t i = 0; i < size; ++i) {
+        result.host_ptr()[i] = value_type(offsets[i + 1] - offsets[i],
+                                          vec.values().data() + offsets[i]);
+    }
+
+    // Return the created object.
+    return result;
+}
+
+template <typename TYPE>
+data::jagged_vector_data<const TYPE> get_data(
+    const flat_jagged_vector<TYPE>& vec, memory_resource* resource) {
+
+    // Construct the object to be returned.
+    const auto size = vec.size();
+    memory_resource& mr = (resource != nullptr
+                               ? *resource
+                               : *(vec.values().get_allocator().resource()));
+    data::jagged_vector_data<const TYPE> result(size, mr);
+
+    // Helper local type definition(s).
+    typedef
+        typename data::jagged_vector_data<const TYPE>::value_type value_type;
+
+    // Fill the result object with information. All rows are placed right
+    // after each other in memory.
+    const auto& offsets = vec.offsets();
+    for (std::size_t i = 0; i < size; ++i) {
+        result.host_ptr()[i] = value_type(offsets[i + 1] - offsets[i],
+                                          vec.values().data() + offsets[i]);
+    }
+
+    // Return the created object.
+    return result;
+}
+
+}  // namespace vecmem
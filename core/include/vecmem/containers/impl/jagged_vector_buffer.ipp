@@ -9,6 +9,7 @@
 
 // vecmem include(s).
 #include "vecmem/containers/details/aligned_multiple_placement.hpp"
+#include "vecmem/containers/details/parallel_scan.hpp"
 
 // System include(s).
 #include <algorithm>
@@ -105,6 +106,51 @@ jagged_vector_buffer<TYPE>::jagged_vector_buffer(
     }
 }
 
+template <typename TYPE>
+template <typename SIZE_TYPE,
+          std::enable_if_t<std::is_integral<SIZE_TYPE>::value &&
+                               std::is_unsigned<SIZE_TYPE>::value,
+                           bool> >
+jagged_vector_buffer<TYPE>::jagged_vector_buffer(
+    const vector_view<SIZE_TYPE>& sizes, memory_resource& resource,
+    memory_resource* host_access_resource, thread_pool* pool)
+    : base_type(sizes.size(), nullptr),
+      m_outer_memory(::allocate_jagged_buffer_outer_memory<TYPE>(
+          (host_access_resource == nullptr ? 0 : sizes.size()), resource)),
+      m_outer_host_memory(::allocate_jagged_buffer_outer_memory<TYPE>(
+          sizes.size(),
+          (host_access_resource == nullptr ? resource
+                                           : *host_access_resource))) {
+
+    // Calculate the offsets of the "inner vectors".
+    const std::size_t n = sizes.size();
+    std::vector<std::size_t> offsets(n + 1);
+    details::exclusive_scan_sizes(sizes.ptr(), n, offsets.data(), pool);
+
+    // Allocate all of the "inner vectors" in one go.
+    m_inner_memory =
+        vecmem::make_unique_alloc<char[]>(resource, offsets[n] * sizeof(TYPE));
+
+    // Point the base class at the newly allocated memory.
+    base_type::m_ptr =
+        ((host_access_resource != nullptr) ? m_outer_memory.get()
+                                           : m_outer_host_memory.get());
+    base_type::m_host_ptr = m_outer_host_memory.get();
+
+    // Set up the host accessible memory array.
+    TYPE* data_ptr = reinterpret_cast<TYPE*>(m_inner_memory.get());
+    details::parallel_scan_for_blocks(
+        n, details::parallel_scan_blocks(n, pool), pool,
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                new (base_type::host_ptr() + i) value_type(
+                    static_cast<typename value_type::size_type>(
+                        offsets[i + 1] - offsets[i]),
+                    data_ptr + offsets[i]);
+            }
+        });
+}
+
 template <typename TYPE>
 template <typename SIZE_TYPE,
           std::enable_if_t<std::is_integral<SIZE_TYPE>::value &&
@@ -0,0 +1,77 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// vecmem include(s).
+#include "vecmem/containers/details/aligned_multiple_placement.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace vecmem {
+namespace data {
+
+/// Like for @c vecmem::data::vector_buffer, the base class does not set its
+/// members in its default constructor. So it needs to be done explicitly
+/// here.
+template <typename... TYPES>
+soa_buffer<TYPES...>::soa_buffer()
+    : base_type(static_cast<size_type>(0), pointers{}) {}
+
+template <typename... TYPES>
+soa_buffer<TYPES...>::soa_buffer(size_type size, memory_resource& resource)
+    : soa_buffer(size, size, resource) {}
+
+template <typename... TYPES>
+soa_buffer<TYPES...>::soa_buffer(size_type capacity, size_type size,
+                                 memory_resource& resource)
+    : base_type(capacity, nullptr, pointers{}) {
+
+    // A sanity check.
+    assert(capacity >= size);
+
+    // Exit early for null-capacity buffers.
+    if (capacity == 0) {
+        return;
+    }
+
+    // Allocate the size variable (if needed) and all of the columns in one go.
+    auto memory = details::aligned_multiple_placement<
+        std::remove_pointer_t<size_pointer>, std::remove_const_t<TYPES>...>(
+        resource, size == capacity ? 0 : 1,
+        (static_cast<void>(sizeof(TYPES)), std::size_t{capacity})...);
+
+    // Set up the members of the object from the allocation.
+    std::apply(
+        [this](auto& mem, auto size_ptr, auto... column_ptrs) {
+            m_memory = std::move(mem);
+            base_type::m_size = size_ptr;
+            base_type::m_ptrs = pointers(column_ptrs...);
+        },
+        memory);
+}
+
+}  // namespace data
+
+template <typename... TYPES>
+data::soa_view<TYPES...>& get_data(data::soa_buffer<TYPES...>& data) {
+
+    return data;
+}
+
+template <typename... TYPES>
+const data::soa_view<TYPES...>& get_data(
+    const data::soa_buffer<TYPES...>& data) {
+
+    return data;
+}
+
+}  // namespace vecmem
@@ -0,0 +1,124 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <new>
+
+namespace vecmem {
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE soa_device<TYPES...>::soa_device(const view_type& data)
+    : m_data(data) {}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::operator[](size_type pos)
+    -> reference {
+
+    // Check if the index is valid.
+    assert(pos < size());
+
+    // Return a proxy to the element.
+    return reference(m_data.ptrs(), pos);
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::operator[](
+    size_type pos) const -> const_reference {
+
+    // Check if the index is valid.
+    assert(pos < size());
+
+    // Return a proxy to the element.
+    return const_reference(m_data.ptrs(), pos);
+}
+
+template <typename... TYPES>
+template <std::size_t I>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::get(size_type pos) const
+    -> element_type<I>& {
+
+    // Check if the index is valid.
+    assert(pos < size());
+
+    // Return the requested member.
+    return m_data.template ptr<I>()[pos];
+}
+
+template <typename... TYPES>
+template <std::size_t I>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::column() const
+    -> device_vector<element_type<I> > {
+
+    return device_vector<element_type<I> >(m_data.template column<I>());
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::push_back(
+    const std::remove_const_t<TYPES>&... values) -> size_type {
+
+    // This can only be done on a resizable collection.
+    assert(m_data.size_ptr() != nullptr);
+
+    // Increment the size of the collection at first. So that we would "claim"
+    // the index from other threads.
+    device_atomic_ref<size_type> asize(*(m_data.size_ptr()));
+    const size_type index = asize.fetch_add(1);
+
+    // Only instantiate the new values if they fit into the collection. The
+    // size of the collection keeps counting the requested elements either
+    // way.
+    if (index < m_data.capacity()) {
+        construct(index, std::index_sequence_for<TYPES...>{}, values...);
+    }
+
+    // Return the index under which the element was (or would have been)
+    // inserted.
+    return index;
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE bool soa_device<TYPES...>::empty() const {
+
+    return (size() == 0);
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::size() const -> size_type {
+
+    if (m_data.size_ptr() == nullptr) {
+        return m_data.capacity();
+    }
+    // For the host, CUDA and HIP backends a plain read would be enough. But
+    // SYCL needs an atomic reference for a coherent view of the size.
+    device_atomic_ref<size_type> asize(
+        *(const_cast<size_type*>(m_data.size_ptr())));
+    const size_type size = asize.load();
+    return (size < m_data.capacity() ? size : m_data.capacity());
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_device<TYPES...>::capacity() const
+    -> size_type {
+
+    return m_data.capacity();
+}
+
+template <typename... TYPES>
+template <std::size_t... Is>
+VECMEM_HOST_AND_DEVICE void soa_device<TYPES...>::construct(
+    size_type pos, std::index_sequence<Is...>,
+    const std::remove_const_t<TYPES>&... values) {
+
+    // Construct the new member in every column, in one go.
+    (static_cast<void>(new (m_data.template ptr<Is>() + pos)
+                           element_type<Is>(values)),
+     ...);
+}
+
+}  // namespace vecmem
@@ -0,0 +1,130 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+
+namespace vecmem {
+
+template <typename... TYPES>
+soa_vector<TYPES...>::soa_vector(memory_resource& resource)
+    : m_columns(vector<TYPES>(&resource)...) {}
+
+template <typename... TYPES>
+soa_vector<TYPES...>::soa_vector(size_type size, memory_resource& resource)
+    : m_columns(vector<TYPES>(size, &resource)...) {}
+
+template <typename... TYPES>
+auto soa_vector<TYPES...>::operator[](size_type pos) -> reference {
+
+    // Check if the index is valid.
+    assert(pos < size());
+
+    // Return a proxy to the element.
+    return reference(ptrs(), pos);
+}
+
+template <typename... TYPES>
+auto soa_vector<TYPES...>::operator[](size_type pos) const
+    -> const_reference {
+
+    // Check if the index is valid.
+    assert(pos < size());
+
+    // Return a proxy to the element.
+    return const_reference(ptrs(), pos);
+}
+
+template <typename... TYPES>
+template <std::size_t I>
+auto soa_vector<TYPES...>::column() -> vector<element_type<I> >& {
+
+    return std::get<I>(m_columns);
+}
+
+template <typename... TYPES>
+template <std::size_t I>
+auto soa_vector<TYPES...>::column() const
+    -> const vector<element_type<I> >& {
+
+    return std::get<I>(m_columns);
+}
+
+template <typename... TYPES>
+void soa_vector<TYPES...>::push_back(const TYPES&... values) {
+
+    std::apply([&](auto&... columns) { (columns.push_back(values), ...); },
+               m_columns);
+}
+
+template <typename... TYPES>
+void soa_vector<TYPES...>::resize(size_type size) {
+
+    std::apply([size](auto&... columns) { (columns.resize(size), ...); },
+               m_columns);
+}
+
+template <typename... TYPES>
+void soa_vector<TYPES...>::reserve(size_type size) {
+
+    std::apply([size](auto&... columns) { (columns.reserve(size), ...); },
+               m_columns);
+}
+
+template <typename... TYPES>
+void soa_vector<TYPES...>::clear() {
+
+    std::apply([](auto&... columns) { (columns.clear(), ...); }, m_columns);
+}
+
+template <typename... TYPES>
+bool soa_vector<TYPES...>::empty() const {
+
+    return std::get<0>(m_columns).empty();
+}
+
+template <typename... TYPES>
+auto soa_vector<TYPES...>::size() const -> size_type {
+
+    return static_cast<size_type>(std::get<0>(m_columns).size());
+}
+
+template <typename... TYPES>
+details::soa_pointers<TYPES...> soa_vector<TYPES...>::ptrs() {
+
+    return std::apply(
+        [](auto&... columns) {
+            return details::soa_pointers<TYPES...>(columns.data()...);
+        },
+        m_columns);
+}
+
+template <typename... TYPES>
+details::soa_pointers<const TYPES...> soa_vector<TYPES...>::ptrs() const {
+
+    return std::apply(
+        [](const auto&... columns) {
+            return details::soa_pointers<const TYPES...>(columns.data()...);
+        },
+        m_columns);
+}
+
+template <typename... TYPES>
+VECMEM_HOST data::soa_view<TYPES...> get_data(soa_vector<TYPES...>& vec) {
+
+    return {vec.size(), vec.ptrs()};
+}
+
+template <typename... TYPES>
+VECMEM_HOST data::soa_view<const TYPES...> get_data(
+    const soa_vector<TYPES...>& vec) {
+
+    return {vec.size(), vec.ptrs()};
+}
+
+}  // namespace vecmem
@@ -0,0 +1,114 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem {
+namespace data {
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE soa_view<TYPES...>::soa_view(size_type size,
+                                                    const pointers& ptrs)
+    : m_capacity(size), m_size(nullptr), m_ptrs(ptrs) {}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE soa_view<TYPES...>::soa_view(size_type capacity,
+                                                    size_pointer size,
+                                                    const pointers& ptrs)
+    : m_capacity(capacity), m_size(size), m_ptrs(ptrs) {}
+
+template <typename... TYPES>
+template <typename... OTHERTYPES,
+          std::enable_if_t<
+              (sizeof...(OTHERTYPES) == sizeof...(TYPES)) &&
+                  details::conjunction_v<
+                      std::is_convertible<OTHERTYPES*, TYPES*>...> &&
+                  (!std::is_same<soa_view<OTHERTYPES...>,
+                                 soa_view<TYPES...> >::value),
+              bool> >
+VECMEM_HOST_AND_DEVICE soa_view<TYPES...>::soa_view(
+    const soa_view<OTHERTYPES...>& parent)
+    : m_capacity(parent.m_capacity),
+      m_size(parent.m_size),
+      m_ptrs(parent.m_ptrs) {}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE bool soa_view<TYPES...>::operator==(
+    const soa_view& rhs) const {
+
+    return ((m_capacity == rhs.m_capacity) && (m_size == rhs.m_size) &&
+            (m_ptrs == rhs.m_ptrs));
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE bool soa_view<TYPES...>::operator!=(
+    const soa_view& rhs) const {
+
+    return !(*this == rhs);
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::size() const -> size_type {
+
+    // The size variable may be larger than the capacity, if more elements
+    // were requested than what fits into the collection.
+    if (m_size == nullptr) {
+        return m_capacity;
+    }
+    return (*m_size < m_capacity ? *m_size : m_capacity);
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::capacity() const
+    -> size_type {
+
+    return m_capacity;
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::size_ptr() -> size_pointer {
+
+    return m_size;
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::size_ptr() const
+    -> const_size_pointer {
+
+    return m_size;
+}
+
+template <typename... TYPES>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::ptrs() const
+    -> const pointers& {
+
+    return m_ptrs;
+}
+
+template <typename... TYPES>
+template <std::size_t I>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::ptr() const
+    -> element_type<I>* {
+
+    return m_ptrs.template get<I>();
+}
+
+template <typename... TYPES>
+template <std::size_t I>
+VECMEM_HOST_AND_DEVICE auto soa_view<TYPES...>::column() const
+    -> vector_view<element_type<I> > {
+
+    // Fixed sized collections have their columns as fixed sized vectors.
+    if (m_size == nullptr) {
+        return {m_capacity, ptr<I>()};
+    }
+    // Resizable collections have resizable columns, all using the same size
+    // variable.
+    return {m_capacity, m_size, ptr<I>()};
+}
+
+}  // namespace data
+}  // namespace vecmem
@@ -0,0 +1,132 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <stdexcept>
+
+namespace vecmem {
+
+template <typename TYPE>
+tracked_vector<TYPE>::tracked_vector(memory_resource& resource,
+                                     dirty_ranges::size_type merge_gap)
+    : m_vector(&resource), m_dirty(merge_gap) {}
+
+template <typename TYPE>
+tracked_vector<TYPE>::tracked_vector(size_type size, const_reference value,
+                                     memory_resource& resource,
+                                     dirty_ranges::size_type merge_gap)
+    : m_vector(size, value, &resource), m_dirty(merge_gap) {
+
+    m_dirty.mark(0, size);
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::operator[](size_type pos) const -> const_reference {
+
+    return m_vector[pos];
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::at(size_type pos) const -> const_reference {
+
+    return m_vector.at(pos);
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::data() const -> const_pointer {
+
+    return m_vector.data();
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::begin() const -> const_iterator {
+
+    return m_vector.begin();
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::end() const -> const_iterator {
+
+    return m_vector.end();
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::size() const -> size_type {
+
+    return m_vector.size();
+}
+
+template <typename TYPE>
+bool tracked_vector<TYPE>::empty() const {
+
+    return m_vector.empty();
+}
+
+template <typename TYPE>
+void tracked_vector<TYPE>::set(size_type pos, const_reference value) {
+
+    modify(pos) = value;
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::modify(size_type pos) -> reference {
+
+    if (pos >= m_vector.size()) {
+        throw std::out_of_range("Invalid index in tracked_vector::modify");
+    }
+    m_dirty.mark(pos);
+    return m_vector[pos];
+}
+
+template <typename TYPE>
+auto tracked_vector<TYPE>::modify(size_type begin, size_type end) -> pointer {
+
+    if ((begin > end) || (end > m_vector.size())) {
+        throw std::out_of_range("Invalid range in tracked_vector::modify");
+    }
+    m_dirty.mark(begin, end);
+    return m_vector.data() + begin;
+}
+
+template <typename TYPE>
+void tracked_vector<TYPE>::assign(size_type size, const_reference value) {
+
+    m_vector.assign(size, value);
+    m_dirty.clear();
+    m_dirty.mark(0, size);
+}
+
+template <typename TYPE>
+void tracked_vector<TYPE>::resize(size_type size, const_reference value) {
+
+    m_vector.resize(size, value);
+    m_dirty.clear();
+    m_dirty.mark(0, size);
+}
+
+template <typename TYPE>
+dirty_ranges& tracked_vector<TYPE>::dirty() {
+
+    return m_dirty;
+}
+
+template <typename TYPE>
+const dirty_ranges& tracked_vector<TYPE>::dirty() const {
+
+    return m_dirty;
+}
+
+template <typename TYPE>
+data::vector_view<const TYPE> get_data(const tracked_vector<TYPE>& vec) {
+
+    return {static_cast<typename data::vector_view<const TYPE>::size_type>(
+                vec.size()),
+            vec.data()};
+}
+
+}  // namespace vecmem
@@ -74,7 +74,12 @@ VECMEM_HOST_AND_DEVICE bool vector_view<TYPE>::operator!=(
 template <typename TYPE>
 VECMEM_HOST_AND_DEVICE auto vector_view<TYPE>::size() const -> size_type {
 
-    return (m_size == nullptr ? m_capacity : *m_size);
+    // The size variable may be larger than the capacity, if more elements
+    // were requested than what fits into the vector.
+    if (m_size == nullptr) {
+        return m_capacity;
+    }
+    return (*m_size < m_capacity ? *m_size : m_capacity);
 }
 
 template <typename TYPE>
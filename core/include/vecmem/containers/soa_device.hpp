@@ -0,0 +1,129 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/soa_view.hpp"
+#include "vecmem/containers/details/soa_pointers.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/memory/device_atomic_ref.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+
+namespace vecmem {
+
+/// Class providing access to a "struct-of-arrays" collection in device code
+///
+/// The elements of the collection are accessed through proxy objects, which
+/// provide access to the members of the element in the different columns of
+/// the collection. Elements can also be added to resizable collections from
+/// multiple threads in parallel, with all of the columns sharing a single
+/// size variable.
+///
+template <typename... TYPES>
+class soa_device {
+
+public:
+    /// @name Type definitions
+    /// @{
+
+    /// Type of the view that the object is constructed from
+    typedef data::soa_view<TYPES...> view_type;
+    /// Size type for the collection
+    typedef typename view_type::size_type size_type;
+    /// Pointer type to the size of the collection
+    typedef typename view_type::size_pointer size_pointer;
+    /// Type holding the pointers to the columns
+    typedef typename view_type::pointers pointers;
+
+    /// Proxy type for the elements of the collection
+    typedef details::soa_reference<TYPES...> reference;
+    /// Constant proxy type for the elements of the collection
+    typedef details::soa_reference<const TYPES...> const_reference;
+
+    /// Type of the I-th column's elements
+    template <std::size_t I>
+    using element_type = typename view_type::template element_type<I>;
+
+    /// @}
+
+    /// Constructor, on top of a previously allocated/filled block of memory
+    VECMEM_HOST_AND_DEVICE
+    soa_device(const view_type& data);
+
+    /// @name Element access functions
+    /// @{
+
+    /// Return a proxy to a specific element of the collection
+    VECMEM_HOST_AND_DEVICE
+    reference operator[](size_type pos);
+    /// Return a constant proxy to a specific element of the collection
+    VECMEM_HOST_AND_DEVICE
+    const_reference operator[](size_type pos) const;
+
+    /// Access one member of a specific element of the collection
+    template <std::size_t I>
+    VECMEM_HOST_AND_DEVICE element_type<I>& get(size_type pos) const;
+
+    /// Access one column of the collection as a device vector
+    template <std::size_t I>
+    VECMEM_HOST_AND_DEVICE device_vector<element_type<I> > column() const;
+
+    /// @}
+
+    /// @name Payload modification functions
+    /// @{
+
+    /// Add a new element to the end of the collection
+    ///
+    /// All of the columns are filled under a single index, claimed with one
+    /// atomic operation on the size of the collection. If the collection is
+    /// already full, the element is not added, but the size of the
+    /// collection still counts it.
+    ///
+    /// @return The index under which the element was inserted, which is not
+    ///         smaller than @c capacity() for elements that did not fit
+    ///
+    VECMEM_HOST_AND_DEVICE
+    size_type push_back(const std::remove_const_t<TYPES>&... values);
+
+    /// @}
+
+    /// @name Capacity checking functions
+    /// @{
+
+    /// Check whether the collection is empty
+    VECMEM_HOST_AND_DEVICE
+    bool empty() const;
+    /// Return the number of elements in the collection
+    VECMEM_HOST_AND_DEVICE
+    size_type size() const;
+    /// Return the number of elements that can be held in the collection
+    VECMEM_HOST_AND_DEVICE
+    size_type capacity() const;
+
+    /// @}
+
+private:
+    /// Helper function filling all of the columns at a given index
+    template <std::size_t... Is>
+    VECMEM_HOST_AND_DEVICE void construct(
+        size_type pos, std::index_sequence<Is...>,
+        const std::remove_const_t<TYPES>&... values);
+
+    /// The view that the object was constructed on
+    view_type m_data;
+
+};  // class soa_device
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/soa_device.ipp"
@@ -0,0 +1,118 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/soa_view.hpp"
+#include "vecmem/containers/details/soa_pointers.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace vecmem {
+
+/// Host container for a "struct-of-arrays" collection
+///
+/// It stores every column of the collection in a separate
+/// @c vecmem::vector, with all of the columns always having the same size.
+/// The elements of the collection can be accessed through proxy objects,
+/// the same way as with @c vecmem::soa_device.
+///
+template <typename... TYPES>
+class soa_vector {
+
+public:
+    /// @name Type definitions
+    /// @{
+
+    /// Size type for the collection
+    typedef typename data::soa_view<TYPES...>::size_type size_type;
+    /// Proxy type for the elements of the collection
+    typedef details::soa_reference<TYPES...> reference;
+    /// Constant proxy type for the elements of the collection
+    typedef details::soa_reference<const TYPES...> const_reference;
+
+    /// Type of the I-th column's elements
+    template <std::size_t I>
+    using element_type = details::soa_element_t<I, TYPES...>;
+
+    /// @}
+
+    /// Constructor with a memory resource
+    soa_vector(memory_resource& resource);
+    /// Constructor with a size and a memory resource
+    soa_vector(size_type size, memory_resource& resource);
+
+    /// @name Element access functions
+    /// @{
+
+    /// Return a proxy to a specific element of the collection
+    reference operator[](size_type pos);
+    /// Return a constant proxy to a specific element of the collection
+    const_reference operator[](size_type pos) const;
+
+    /// Access one column of the collection (non-const)
+    template <std::size_t I>
+    vector<element_type<I> >& column();
+    /// Access one column of the collection (const)
+    template <std::size_t I>
+    const vector<element_type<I> >& column() const;
+
+    /// @}
+
+    /// @name Payload modification functions
+    /// @{
+
+    /// Add a new element to the end of the collection
+    void push_back(const TYPES&... values);
+    /// Change the size of the collection
+    void resize(size_type size);
+    /// Reserve memory for a given number of elements
+    void reserve(size_type size);
+    /// Remove all elements from the collection
+    void clear();
+
+    /// @}
+
+    /// @name Capacity checking functions
+    /// @{
+
+    /// Check whether the collection is empty
+    bool empty() const;
+    /// Return the number of elements in the collection
+    size_type size() const;
+
+    /// @}
+
+    /// Get the pointers to all of the columns (non-const)
+    details::soa_pointers<TYPES...> ptrs();
+    /// Get the pointers to all of the columns (const)
+    details::soa_pointers<const TYPES...> ptrs() const;
+
+private:
+    /// The columns of the collection
+    std::tuple<vector<TYPES>...> m_columns;
+
+};  // class soa_vector
+
+/// Helper function for getting a non-const view of a host collection
+template <typename... TYPES>
+VECMEM_HOST data::soa_view<TYPES...> get_data(soa_vector<TYPES...>& vec);
+
+/// Helper function for getting a const view of a host collection
+template <typename... TYPES>
+VECMEM_HOST data::soa_view<const TYPES...> get_data(
+    const soa_vector<TYPES...>& vec);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/soa_vector.ipp"
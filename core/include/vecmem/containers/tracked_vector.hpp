@@ -0,0 +1,125 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/dirty_ranges.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+/// Host vector that keeps track of which of its elements were modified
+///
+/// Read access to the elements is unrestricted, but all modifications have to
+/// go through the functions of this class, so that the modified index ranges
+/// would be recorded. Which allows @c vecmem::copy::update to transfer only
+/// the modified parts of the vector into a device buffer of the same size.
+///
+/// Newly constructed and resized vectors are marked as modified in their
+/// entirety.
+///
+template <typename TYPE>
+class tracked_vector {
+
+public:
+    /// @name Type definitions
+    /// @{
+
+    /// The type of the underlying vector
+    typedef vector<TYPE> vector_type;
+    /// Type of the vector elements
+    typedef TYPE value_type;
+    /// Size type for the vector
+    typedef typename vector_type::size_type size_type;
+    /// Value reference type
+    typedef value_type& reference;
+    /// Constant value reference type
+    typedef const value_type& const_reference;
+    /// Value pointer type
+    typedef value_type* pointer;
+    /// Constant value pointer type
+    typedef const value_type* const_pointer;
+    /// Constant forward iterator type
+    typedef typename vector_type::const_iterator const_iterator;
+
+    /// @}
+
+    /// @name Constructors
+    /// @{
+
+    /// Construct an empty vector
+    tracked_vector(memory_resource& resource,
+                   dirty_ranges::size_type merge_gap = 0);
+    /// Construct a vector with a specific size
+    tracked_vector(size_type size, const_reference value,
+                   memory_resource& resource,
+                   dirty_ranges::size_type merge_gap = 0);
+
+    /// @}
+
+    /// @name Read access
+    /// @{
+
+    /// Return a specific element of the vector (without bounds checking)
+    const_reference operator[](size_type pos) const;
+    /// Return a specific element of the vector (with bounds checking)
+    const_reference at(size_type pos) const;
+    /// Access the underlying array
+    const_pointer data() const;
+    /// Return a forward iterator pointing at the beginning of the vector
+    const_iterator begin() const;
+    /// Return a forward iterator pointing at the end of the vector
+    const_iterator end() const;
+    /// Get the number of elements in the vector
+    size_type size() const;
+    /// Check whether the vector is empty
+    bool empty() const;
+
+    /// @}
+
+    /// @name Tracked modifications
+    /// @{
+
+    /// Set the value of one element
+    void set(size_type pos, const_reference value);
+    /// Get write access to one element, marking it as modified
+    reference modify(size_type pos);
+    /// Get write access to the [begin, end) range, marking it as modified
+    pointer modify(size_type begin, size_type end);
+    /// Replace the contents of the vector
+    void assign(size_type size, const_reference value);
+    /// Change the size of the vector
+    void resize(size_type size, const_reference value = value_type());
+
+    /// Access the tracker of the modified ranges
+    dirty_ranges& dirty();
+    /// Access the tracker of the modified ranges (const)
+    const dirty_ranges& dirty() const;
+
+    /// @}
+
+private:
+    /// The underlying vector
+    vector_type m_vector;
+    /// The tracker of the modified ranges
+    dirty_ranges m_dirty;
+
+};  // class tracked_vector
+
+/// Helper function creating a @c vecmem::data::vector_view object
+template <typename TYPE>
+data::vector_view<const TYPE> get_data(const tracked_vector<TYPE>& vec);
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/tracked_vector.ipp"
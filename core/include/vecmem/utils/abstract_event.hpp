@@ -7,6 +7,12 @@
  */
 #pragma once
 
+// VecMem include(s).
+#include "vecmem/utils/details/event_deleter.hpp"
+
+// System include(s).
+#include <memory>
+
 namespace vecmem {
 
 /// Interface that language specific "events" need to implement
@@ -27,6 +33,25 @@ struct abstract_event {
     /// complete
     virtual void wait() = 0;
 
+    /// Function checking whether the event is complete
+    ///
+    /// The default implementation waits for the event to complete, to keep
+    /// event types written before this function was introduced working.
+    /// Backends should override it with a non-blocking check.
+    ///
+    virtual bool is_ready() {
+        wait();
+        return true;
+    }
+
 };  // struct abstract_event
 
+/// Owning pointer to an event
+///
+/// Unlike a plain @c std::unique_ptr, it allows events to be recycled (see
+/// @c vecmem::event_pool), or to not be owned at all. So that creating an
+/// event would not need to involve a heap allocation.
+///
+using event_ptr = std::unique_ptr<abstract_event, details::event_deleter>;
+
 }  // namespace vecmem
@@ -0,0 +1,132 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <functional>
+#include <type_traits>
+
+namespace vecmem {
+
+/// Parallel primitives operating on the contents of vector views
+///
+/// The functions in this namespace receive the object that they should
+/// execute on as their first argument. The implementations provided here
+/// take a @c vecmem::thread_pool, and spread their work over its threads.
+/// The views passed to them must be host accessible. Backends for other
+/// execution models provide overloads of the same functions, taking their
+/// own execution object.
+///
+/// All functions split their input into contiguous blocks, one per thread.
+/// The loops over the elements of a block are kept simple, so that the
+/// compiler can vectorize them.
+///
+/// Output views may be resizable. In that case their size is set to the
+/// number of elements written into them. A @c std::length_error exception
+/// is thrown if an output view can not hold all of the elements.
+///
+namespace algorithms {
+
+/// Calculate the sum (or other reduction) of the elements of a view
+///
+/// Like @c std::reduce, the reduction is performed in the type of the
+/// initial value, not in the type of the elements.
+///
+/// @param pool The thread pool to execute the operation with
+/// @param view The view to reduce
+/// @param init The initial value of the reduction
+/// @param op An associative binary operation to reduce the elements with
+/// @return The result of the reduction
+///
+template <typename TYPE, typename T = std::remove_cv_t<TYPE>,
+          typename BINARY_OP = std::plus<> >
+T reduce(thread_pool& pool, const data::vector_view<TYPE>& view, T init = {},
+         BINARY_OP op = {});
+
+/// Calculate the inclusive prefix sum (or other scan) of a view
+///
+/// The input and output views are allowed to be the same.
+///
+/// @param pool The thread pool to execute the operation with
+/// @param input The view to scan
+/// @param output The view to write the results into
+/// @param op An associative binary operation to scan the elements with
+///
+template <typename TYPE1, typename TYPE2, typename BINARY_OP = std::plus<> >
+void inclusive_scan(thread_pool& pool, const data::vector_view<TYPE1>& input,
+                    data::vector_view<TYPE2> output, BINARY_OP op = {});
+
+/// Calculate the exclusive prefix sum (or other scan) of a view
+///
+/// The input and output views are allowed to be the same.
+///
+/// @param pool The thread pool to execute the operation with
+/// @param input The view to scan
+/// @param output The view to write the results into
+/// @param init The initial value of the scan
+/// @param op An associative binary operation to scan the elements with
+/// @return The reduction of all elements, which would be the next element
+///         of the output
+///
+template <typename TYPE1, typename TYPE2, typename BINARY_OP = std::plus<> >
+std::remove_cv_t<TYPE2> exclusive_scan(thread_pool& pool,
+                                       const data::vector_view<TYPE1>& input,
+                                       data::vector_view<TYPE2> output,
+                                       std::remove_cv_t<TYPE2> init = {},
+                                       BINARY_OP op = {});
+
+/// Sort the elements of a view in ascending order
+///
+/// The sort is a (stable) least significant digit radix sort, so it can
+/// only be used with integral and floating point types. Floating point
+/// values are ordered by their bit pattern, with NaN values ending up at
+/// the beginning or at the end of the view depending on their sign.
+///
+/// @param pool The thread pool to execute the operation with
+/// @param view The view to sort
+///
+template <typename TYPE>
+void sort(thread_pool& pool, data::vector_view<TYPE> view);
+
+/// Move the elements satisfying a predicate to the beginning of a view
+///
+/// The relative order of the elements is kept in both of the groups.
+///
+/// @param pool The thread pool to execute the operation with
+/// @param view The view to partition
+/// @param pred The predicate to partition the elements with
+/// @return The number of elements satisfying the predicate
+///
+template <typename TYPE, typename PREDICATE>
+typename data::vector_view<TYPE>::size_type partition(
+    thread_pool& pool, data::vector_view<TYPE> view, PREDICATE pred);
+
+/// Copy the elements satisfying a predicate into another view
+///
+/// This is often called "stream compaction". The relative order of the
+/// elements is kept.
+///
+/// @param pool The thread pool to execute the operation with
+/// @param input The view to copy the elements from
+/// @param output The view to copy the elements into
+/// @param pred The predicate selecting the elements to copy
+/// @return The number of copied elements
+///
+template <typename TYPE1, typename TYPE2, typename PREDICATE>
+typename data::vector_view<TYPE2>::size_type copy_if(
+    thread_pool& pool, const data::vector_view<TYPE1>& input,
+    data::vector_view<TYPE2> output, PREDICATE pred);
+
+}  // namespace algorithms
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/algorithms.ipp"
@@ -0,0 +1,58 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+
+// System include(s).
+#include <memory>
+
+namespace vecmem {
+
+/// Result of an asynchronous operation, with the event signalling its end
+///
+/// The value is held on the heap, so that its address would not change while
+/// the asynchronous operation is writing into it, even if the result object
+/// itself is moved around.
+///
+/// @tparam TYPE The type of the value produced by the operation
+///
+template <typename TYPE>
+class async_result {
+
+public:
+    /// The type of the value produced by the operation
+    typedef TYPE value_type;
+    /// The type of the event used to wait for the operation
+    typedef event_ptr event_type;
+
+    /// Constructor from a value and the event signalling its completion
+    async_result(std::unique_ptr<value_type> value, event_type event);
+
+    /// Check whether the object holds a value
+    bool valid() const;
+
+    /// Wait for the operation to finish
+    void wait();
+
+    /// Wait for the operation to finish, and access its result
+    value_type& get();
+
+private:
+    /// The result of the operation
+    std::unique_ptr<value_type> m_value;
+    /// The event signalling the end of the operation
+    event_type m_event;
+
+};  // class async_result
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/async_result.ipp"
@@ -0,0 +1,101 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+// Forward declaration(s).
+class thread_pool;
+
+/// Base class for (lossless) compression codecs
+///
+/// Data is compressed into self-describing "frames". The input is split into
+/// fixed sized chunks, which are compressed independently of each other, so
+/// that both compression and decompression can be performed in parallel on a
+/// @c vecmem::thread_pool. Chunks that do not compress are stored as-is.
+///
+/// Codec implementations only need to implement the compression and
+/// decompression of individual chunks.
+///
+class VECMEM_CORE_EXPORT codec {
+
+public:
+    /// The default size of the independently compressed chunks
+    static constexpr std::size_t default_chunk_size = 256 * 1024;
+
+    /// Constructor with the chunk size to use
+    codec(std::size_t chunk_size = default_chunk_size);
+    /// Virtual destructor
+    virtual ~codec();
+
+    /// Get the size of the independently compressed chunks
+    std::size_t chunk_size() const;
+
+    /// Get the maximal size of the frame created from @c size bytes
+    std::size_t max_compressed_size(std::size_t size) const;
+
+    /// Compress a memory block into a frame
+    ///
+    /// @param in The memory block to compress
+    /// @param size The size of the memory block to compress
+    /// @param out The memory to write the frame into
+    /// @param capacity The size of the memory block at @c out, which has to
+    ///        be at least @c max_compressed_size(size)
+    /// @param pool Optional thread pool to compress the chunks with
+    /// @return The size of the created frame
+    ///
+    std::size_t compress(const void* in, std::size_t size, void* out,
+                         std::size_t capacity,
+                         thread_pool* pool = nullptr) const;
+
+    /// Decompress a frame into a memory block
+    ///
+    /// @param in The frame to decompress
+    /// @param frame_size The size of the frame
+    /// @param out The memory to write the decompressed data into
+    /// @param size The size of the memory block at @c out, which has to be
+    ///        equal to the decompressed size of the frame
+    /// @param pool Optional thread pool to decompress the chunks with
+    ///
+    void decompress(const void* in, std::size_t frame_size, void* out,
+                    std::size_t size, thread_pool* pool = nullptr) const;
+
+    /// Get the decompressed size of a frame
+    static std::size_t decompressed_size(const void* in,
+                                         std::size_t frame_size);
+
+protected:
+    /// Get the maximal compressed size of a single chunk
+    virtual std::size_t do_max_compressed_size(std::size_t size) const = 0;
+    /// Compress a single chunk
+    ///
+    /// @return The compressed size, or 0 if the data did not fit into
+    ///         @c capacity bytes
+    ///
+    virtual std::size_t do_compress(const void* in, std::size_t size,
+                                    void* out, std::size_t capacity) const = 0;
+    /// Decompress a single chunk
+    ///
+    /// Implementations must throw @c std::runtime_error for invalid input.
+    ///
+    virtual void do_decompress(const void* in, std::size_t compressed_size,
+                               void* out, std::size_t size) const = 0;
+
+private:
+    /// The size of the independently compressed chunks
+    std::size_t m_chunk_size;
+
+};  // class codec
+
+}  // namespace vecmem
@@ -10,20 +10,33 @@
 // VecMem include(s).
 #include "vecmem/containers/data/jagged_vector_buffer.hpp"
 #include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/soa_buffer.hpp"
+#include "vecmem/containers/data/soa_view.hpp"
 #include "vecmem/containers/data/vector_buffer.hpp"
 #include "vecmem/containers/data/vector_view.hpp"
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/async_result.hpp"
+#include "vecmem/utils/dirty_ranges.hpp"
 #include "vecmem/vecmem_core_export.hpp"
 
 // System include(s).
 #include <cstddef>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace vecmem {
 
+// Forward declaration(s).
+class codec;
+template <typename TYPE>
+class flat_jagged_vector;
+class copy_batch;
+class copy_plan;
+class thread_pool;
+
 /// Class implementing (synchronous) host <-> device memory copies
 ///
 /// Since most of the logic of explicitly copying the payload of vecmem
@@ -36,6 +49,13 @@ namespace vecmem {
 ///
 class VECMEM_CORE_EXPORT copy {
 
+    // Let the batch and plan types use the internal helper functions of the
+    // class.
+    friend class copy_batch;
+    friend class copy_plan;
+    // Let the instrumenting copy forward its calls to other copy objects.
+    friend class instrumenting_copy;
+
 public:
     /// Wrapper struct around the @c copy_type enumeration
     ///
@@ -62,7 +82,84 @@ public:
     };      // struct type
 
     /// Event type used by the copy class
-    using event_type = std::unique_ptr<abstract_event>;
+    using event_type = event_ptr;
+
+    /// Description of a single, contiguous "low level" memory copy
+    struct segment {
+        /// The number of bytes to copy
+        std::size_t size;
+        /// The (start of the) source memory block
+        const void* from;
+        /// The (start of the) target memory block
+        void* to;
+    };  // struct segment
+
+    /// Configuration for packing non-contiguous jagged copies
+    ///
+    /// Copying a jagged vector that is not contiguous in memory on the host
+    /// side (like a @c vecmem::jagged_vector) into/out of a contiguous buffer
+    /// normally needs one copy per "inner vector". With many small inner
+    /// vectors it is much more efficient to pack them into a contiguous
+    /// staging buffer on the host, and to transfer that in one go.
+    ///
+    /// This is done automatically for host-to-device and device-to-host
+    /// copies that would need at least @c min_segments separate copies of
+    /// at most @c max_average_size bytes on average. Such copies are
+    /// synchronous.
+    ///
+    /// With a non-zero @c chunk_size, staged copies (and 1-dimensional
+    /// host-to-device and device-to-host copies) larger than one chunk are
+    /// pipelined. The transfer is split into chunks, going through
+    /// @c n_buffers rotating staging buffers, with the host side packing
+    /// (unpacking) of the chunks performed on a helper thread. So that the
+    /// packing of one chunk would overlap with the transfer of another.
+    ///
+    struct staging_config {
+        /// Host memory resource for the staging buffers
+        ///
+        /// Ideally it should provide pinned memory. Staging is disabled
+        /// while it is not set.
+        ///
+        memory_resource* resource = nullptr;
+        /// The minimum number of copies that would be packed together
+        std::size_t min_segments = 16;
+        /// The maximum average size (in bytes) of the packed copies
+        std::size_t max_average_size = 64 * 1024;
+        /// Optional thread pool to pack/unpack the staging buffer with
+        thread_pool* pool = nullptr;
+        /// The size (in bytes) of the chunks of pipelined copies
+        ///
+        /// Pipelining is disabled while it is zero.
+        ///
+        std::size_t chunk_size = 0;
+        /// The number of rotating staging buffers used in pipelined copies
+        std::size_t n_buffers = 2;
+    };  // struct staging_config
+
+    /// Configuration for compressing large host-to-host copies
+    ///
+    /// Copies of at least @c threshold bytes are compressed before, and
+    /// decompressed after being handed to @c do_copy. Which makes transfers
+    /// over bandwidth-limited host-to-host links (implemented by the
+    /// @c do_copy function of a derived class) faster for compressible data.
+    /// Such copies are synchronous.
+    ///
+    /// Only @c host_to_host copies can be compressed, as the data needs to be
+    /// decompressed by the host on the receiving side as well.
+    ///
+    struct compression_config {
+        /// The codec to use for the compression
+        ///
+        /// Compression is disabled while it is not set.
+        ///
+        const codec* compressor = nullptr;
+        /// The minimum size (in bytes) of the copies to compress
+        std::size_t threshold = 1024 * 1024;
+        /// Optional host memory resource for the compressed data
+        memory_resource* resource = nullptr;
+        /// Optional thread pool to (de-)compress the data with
+        thread_pool* pool = nullptr;
+    };  // struct compression_config
 
     /// @name 1-dimensional vector data handling functions
     /// @{
@@ -84,6 +181,33 @@ public:
         const data::vector_view<TYPE>& data, memory_resource& resource,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy a 1-dimensional vector into a re-usable buffer
+    ///
+    /// The buffer is only re-allocated (from @c resource) if it can not hold
+    /// the contents of @c data. A resizable source requires a resizable
+    /// buffer with at least the capacity of the source, while a fixed sized
+    /// source requires a fixed sized buffer of exactly the same size.
+    ///
+    /// If the buffer has the same capacity as a resizable source, no
+    /// synchronization is done by the function. The full capacity of the
+    /// source is copied, together with its size variable, without querying
+    /// it. If a larger buffer is re-used, the size of the source has to be
+    /// read first, and only the elements stored in the source are copied.
+    /// The returned event signals the end of the copy.
+    ///
+    template <typename TYPE>
+    event_type to(const data::vector_view<TYPE>& data,
+                  data::vector_buffer<std::remove_cv_t<TYPE>>& buffer,
+                  memory_resource& resource,
+                  type::copy_type cptype = type::unknown) const;
+
+    /// Copy a 1-dimensional vector to the specified memory resource
+    /// asynchronously
+    template <typename TYPE>
+    async_result<data::vector_buffer<std::remove_cv_t<TYPE>>> to_async(
+        const data::vector_view<TYPE>& data, memory_resource& resource,
+        type::copy_type cptype = type::unknown) const;
+
     /// Copy a 1-dimensional vector's data between two existing memory blocks
     template <typename TYPE1, typename TYPE2>
     event_type operator()(const data::vector_view<TYPE1>& from,
@@ -96,11 +220,63 @@ public:
                           std::vector<TYPE2, ALLOC>& to,
                           type::copy_type cptype = type::unknown) const;
 
+    /// Copy a 1-dimensional vector, converting its elements to a new type
+    ///
+    /// The conversion happens on the source side for host-to-device copies,
+    /// so only the converted elements are transferred. For device-to-host
+    /// copies the elements are converted on the host after the transfer.
+    /// The copy direction has to be specified explicitly, and the function is
+    /// synchronous.
+    ///
+    /// Host memory for the conversion is taken from the staging resource if
+    /// one is set up, with the staging thread pool (if any) also used for the
+    /// conversion.
+    ///
+    template <typename TYPE1, typename TYPE2>
+    event_type convert(const data::vector_view<TYPE1>& from,
+                       data::vector_view<TYPE2> to,
+                       type::copy_type cptype) const;
+
+    /// Copy only the modified ranges of a 1-dimensional vector
+    ///
+    /// The target has to be a fixed sized view/buffer that already holds an
+    /// earlier copy of the (full) source. After the copies are launched, the
+    /// tracked ranges are cleared. The source must not be modified until the
+    /// returned event is waited on.
+    ///
+    template <typename TYPE1, typename TYPE2>
+    event_type update(const data::vector_view<TYPE1>& from,
+                      data::vector_view<TYPE2> to, dirty_ranges& dirty,
+                      type::copy_type cptype = type::unknown) const;
+
     /// Helper function for getting the size of a resizable 1D buffer
+    ///
+    /// For buffers that more elements were added to than what they could
+    /// hold, this is the number of requested elements, which is larger than
+    /// the capacity of the buffer. (Copies only ever handle the elements
+    /// that fit into the buffer.)
+    ///
     template <typename TYPE>
     typename data::vector_view<TYPE>::size_type get_size(
         const data::vector_view<TYPE>& data) const;
 
+    /// Helper function for getting the sizes of many (resizable) 1D buffers
+    ///
+    /// The sizes of all resizable buffers are fetched with a single batched
+    /// copy, waiting for its completion only once.
+    ///
+    template <typename TYPE>
+    std::vector<typename data::vector_view<TYPE>::size_type> get_sizes(
+        const std::vector<data::vector_view<TYPE>>& data) const;
+
+    /// Start fetching the sizes of many (resizable) 1D buffers
+    ///
+    /// The returned object must be waited on before its value would be used.
+    ///
+    template <typename TYPE>
+    async_result<std::vector<typename data::vector_view<TYPE>::size_type>>
+    get_sizes_async(const std::vector<data::vector_view<TYPE>>& data) const;
+
     /// @}
 
     /// @name Jagged vector data handling functions
@@ -121,6 +297,44 @@ public:
         memory_resource* host_access_resource = nullptr,
         type::copy_type cptype = type::unknown) const;
 
+    /// Copy a jagged vector into a re-usable buffer
+    ///
+    /// The buffer is only re-allocated if it does not have the same number of
+    /// "inner vectors" as @c data, or if any of its inner vectors can not
+    /// hold the contents of the corresponding source vector. Re-allocated
+    /// buffers are always resizable.
+    ///
+    /// The sizes of the source are queried synchronously, but the returned
+    /// event is the only one that needs to be waited on for the copy.
+    ///
+    template <typename TYPE>
+    event_type to(const data::jagged_vector_view<TYPE>& data,
+                  data::jagged_vector_buffer<std::remove_cv_t<TYPE>>& buffer,
+                  memory_resource& resource,
+                  memory_resource* host_access_resource = nullptr,
+                  type::copy_type cptype = type::unknown) const;
+
+    /// Copy a jagged vector to the specified memory resource asynchronously
+    template <typename TYPE>
+    async_result<data::jagged_vector_buffer<std::remove_cv_t<TYPE>>> to_async(
+        const data::jagged_vector_view<TYPE>& data, memory_resource& resource,
+        memory_resource* host_access_resource = nullptr,
+        type::copy_type cptype = type::unknown) const;
+
+    /// Copy the used elements of a jagged vector into a tight buffer
+    ///
+    /// Meant for resizable jagged buffers, whose rows are usually only
+    /// partially filled. The sizes of the rows are fetched with a single
+    /// batched copy, and the result is a fixed size buffer holding only
+    /// the used elements of every row, placed right after each other. The
+    /// rows are gathered into it with a single batch of copies.
+    ///
+    template <typename TYPE>
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> compact(
+        const data::jagged_vector_view<TYPE>& data, memory_resource& resource,
+        memory_resource* host_access_resource = nullptr,
+        type::copy_type cptype = type::unknown) const;
+
     /// Copy a jagged vector's data between two existing allocations
     template <typename TYPE1, typename TYPE2>
     event_type operator()(const data::jagged_vector_view<TYPE1>& from,
@@ -133,11 +347,36 @@ public:
                           std::vector<std::vector<TYPE2, ALLOC2>, ALLOC1>& to,
                           type::copy_type cptype = type::unknown) const;
 
+    /// Copy a jagged vector's data into a flat jagged vector object
+    template <typename TYPE1, typename TYPE2>
+    event_type operator()(const data::jagged_vector_view<TYPE1>& from,
+                          flat_jagged_vector<TYPE2>& to,
+                          type::copy_type cptype = type::unknown) const;
+
     /// Helper function for getting the sizes of a resizable jagged vector
     template <typename TYPE>
     std::vector<typename data::vector_view<TYPE>::size_type> get_sizes(
         const data::jagged_vector_view<TYPE>& data) const;
 
+    /// Helper function for getting the sizes of many resizable jagged vectors
+    ///
+    /// The sizes of all jagged vectors are fetched with a single batched
+    /// copy, waiting for its completion only once.
+    ///
+    template <typename TYPE>
+    std::vector<std::vector<typename data::vector_view<TYPE>::size_type>>
+    get_sizes(const std::vector<data::jagged_vector_view<TYPE>>& data) const;
+
+    /// Start fetching the sizes of many resizable jagged vectors
+    ///
+    /// The returned object must be waited on before its value would be used.
+    ///
+    template <typename TYPE>
+    async_result<
+        std::vector<std::vector<typename data::vector_view<TYPE>::size_type>>>
+    get_sizes_async(
+        const std::vector<data::jagged_vector_view<TYPE>>& data) const;
+
     /// Helper function for setting the sizes of a resizable jagged vector
     template <typename TYPE>
     event_type set_sizes(
@@ -146,16 +385,106 @@ public:
 
     /// @}
 
+    /// @name Struct-of-arrays data handling functions
+    /// @{
+
+    /// Set up the internal state of a struct-of-arrays buffer on a device
+    template <typename... TYPES>
+    event_type setup(data::soa_view<TYPES...> data) const;
+
+    /// Set all bytes of all columns of a struct-of-arrays collection to some
+    /// value
+    template <typename... TYPES>
+    event_type memset(data::soa_view<TYPES...> data, int value) const;
+
+    /// Copy a struct-of-arrays collection into a compatible view
+    ///
+    /// The size of a resizable target and all of the columns are copied with
+    /// a single call to @c do_copy_batch.
+    ///
+    template <typename... TYPES1, typename... TYPES2>
+    event_type operator()(const data::soa_view<TYPES1...>& from,
+                          data::soa_view<TYPES2...> to,
+                          type::copy_type cptype = type::unknown) const;
+
+    /// Helper function for getting the size of a struct-of-arrays collection
+    template <typename... TYPES>
+    typename data::soa_view<TYPES...>::size_type get_size(
+        const data::soa_view<TYPES...>& data) const;
+
+    /// @}
+
+    /// @name Batched/planned copy handling functions
+    /// @{
+
+    /// Perform all of the copies collected in a batch
+    ///
+    /// The segments of the batch are sorted and merged wherever they are
+    /// adjacent both on the source and on the target side, before being handed
+    /// to @c do_copy_batch in one go.
+    ///
+    event_type operator()(const copy_batch& batch,
+                          type::copy_type cptype = type::unknown) const;
+
+    /// Replay all of the operations recorded in a plan
+    ///
+    /// The memory filling operations of the plan are performed first, then
+    /// all of its copies are handed to @c do_copy_batch in one go.
+    ///
+    event_type operator()(const copy_plan& plan,
+                          type::copy_type cptype = type::unknown) const;
+
+    /// @}
+
+    /// @name Configuration functions
+    /// @{
+
+    /// Set up the packing of non-contiguous jagged copies
+    void set_staging(const staging_config& config);
+    /// Get the configuration for packing non-contiguous jagged copies
+    const staging_config& get_staging() const;
+
+    /// Set up the compression of large host-to-host copies
+    void set_compression(const compression_config& config);
+    /// Get the configuration for compressing large host-to-host copies
+    const compression_config& get_compression() const;
+
+    /// @}
+
 protected:
     /// Perform a "low level" memory copy
     virtual void do_copy(std::size_t size, const void* from, void* to,
                          type::copy_type cptype) const;
+    /// Perform a batch of "low level" memory copies
+    ///
+    /// The default implementation calls @c do_copy for every segment one by
+    /// one. Backends that can execute many copies with a single call should
+    /// override this function.
+    ///
+    virtual void do_copy_batch(const std::vector<segment>& segments,
+                               type::copy_type cptype) const;
+    /// Perform a "low level" memory copy from a temporary host buffer
+    ///
+    /// The source of the copy may be destroyed as soon as this function
+    /// returns, even if the copy itself is not finished yet. The default
+    /// implementation calls @c do_copy, which is correct for all backends
+    /// that read the source before returning. Asynchronous backends need to
+    /// override it.
+    ///
+    virtual void do_copy_temporary(std::size_t size, const void* from,
+                                   void* to, type::copy_type cptype) const;
     /// Perform a "low level" memory filling operation
     virtual void do_memset(std::size_t size, void* ptr, int value) const;
     /// Create an event for synchronization
     virtual event_type create_event() const;
 
 private:
+    /// Helper function copying jagged vectors with known source sizes
+    template <typename TYPE1, typename TYPE2>
+    event_type copy_jagged_impl(
+        const std::vector<typename data::vector_view<TYPE1>::size_type>& sizes,
+        const data::jagged_vector_view<TYPE1>& from,
+        data::jagged_vector_view<TYPE2> to, type::copy_type cptype) const;
     /// Helper function performing the copy of a jagged array/vector
     template <typename TYPE1, typename TYPE2>
     void copy_views_impl(
@@ -172,10 +501,99 @@ private:
     template <typename TYPE>
     std::vector<typename data::vector_view<TYPE>::size_type> get_sizes_impl(
         const data::vector_view<TYPE>* data, std::size_t size) const;
+    /// Helper function collecting the size copies for a jagged vector/buffer
+    ///
+    /// Sizes that can be determined right away are written into @c result
+    /// directly, the copies necessary for the rest are added to @c segments.
+    ///
+    template <typename TYPE>
+    static void get_sizes_segments(
+        const data::vector_view<TYPE>* data, std::size_t size,
+        typename data::vector_view<TYPE>::size_type* result,
+        std::vector<segment>& segments);
+    /// Zero the size variables of the (resizable) inner vectors of a jagged
+    /// vector/buffer
+    template <typename TYPE>
+    void fill_sizes(const data::vector_view<TYPE>* data,
+                    std::size_t size) const;
+    /// Get the number of elements stored in a (resizable) vector/collection
+    ///
+    /// Unlike @c get_size, this never returns more than the capacity of the
+    /// view, even if more elements were added to it than it could hold.
+    ///
+    template <typename VIEW>
+    auto stored_size(const VIEW& data) const -> typename VIEW::size_type;
+    /// Set the size variable of a resizable target from the host
+    ///
+    /// The size variable is set directly if the copy type says that the
+    /// target is in host memory, and is copied from a temporary otherwise.
+    ///
+    void write_size(data::vector_view<char>::size_type size,
+                    data::vector_view<char>::size_type* ptr,
+                    type::copy_type cptype) const;
+    /// Limit the sizes of a jagged vector to the capacities of its "inner
+    /// vectors"
+    template <typename TYPE>
+    static void clamp_sizes(
+        std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+        const data::vector_view<TYPE>* data);
     /// Check if a vector of views occupy a contiguous block of memory
     template <typename TYPE>
     static bool is_contiguous(const data::vector_view<TYPE>* data,
                               std::size_t size);
+    /// Check whether the sizes of a jagged vector need to be set explicitly
+    template <typename TYPE>
+    static bool needs_size_update(
+        const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+        const data::jagged_vector_view<TYPE>& data);
+    /// Helper function collecting the column copies of a struct-of-arrays
+    /// collection
+    template <typename... TYPES1, typename... TYPES2, std::size_t... Is>
+    static void soa_segments(const data::soa_view<TYPES1...>& from,
+                             const data::soa_view<TYPES2...>& to,
+                             std::size_t size, std::index_sequence<Is...>,
+                             std::vector<segment>& segments);
+    /// Sort and merge adjacent copy segments
+    static std::vector<segment> coalesce(std::vector<segment> segments);
+    /// Perform a host-to-device or device-to-host batch through a staging
+    /// buffer, if that is worth it
+    ///
+    /// The device side of the copies must be contiguous, with any gaps
+    /// between the segments being safe to overwrite.
+    ///
+    /// @return @c true if the copies were performed, @c false otherwise
+    ///
+    bool staged_copy(const std::vector<segment>& segments,
+                     type::copy_type cptype) const;
+    /// Perform a large host-to-device or device-to-host copy in a pipelined
+    /// way, if that is configured
+    ///
+    /// @return @c true if the copy was performed, @c false otherwise
+    ///
+    bool pipelined_copy(std::size_t size, const void* from, void* to,
+                        type::copy_type cptype) const;
+    /// Perform a host-to-device or device-to-host batch through rotating
+    /// staging buffers
+    ///
+    /// The device side of the copies must span the memory block of
+    /// @c extent bytes starting at @c begin, with any gaps between the
+    /// segments being safe to overwrite.
+    ///
+    void pipelined_copy(const std::vector<segment>& segments,
+                        const char* begin, std::size_t extent,
+                        type::copy_type cptype) const;
+    /// Perform a host-to-host copy through the configured codec, if that is
+    /// appropriate
+    ///
+    /// @return @c true if the copy was performed, @c false otherwise
+    ///
+    bool compressed_copy(std::size_t size, const void* from, void* to,
+                         type::copy_type cptype) const;
+
+    /// Configuration for packing non-contiguous jagged copies
+    staging_config m_staging;
+    /// Configuration for compressing large host-to-host copies
+    compression_config m_compression;
 
 };  // class copy
 
@@ -0,0 +1,94 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+/// Collection of memory copies to be performed in one go
+///
+/// Copies between any number of (1-dimensional or jagged) views can be
+/// collected in such an object, and then be executed with a single call to
+/// @c vecmem::copy::operator(). Which merges all copy segments that are
+/// adjacent both on their source and on their target side, and hands the
+/// result to the backend in a single @c vecmem::copy::do_copy_batch call.
+///
+/// The sizes of resizable source views are determined at the time that they
+/// are added to the batch. The sizes of resizable target views are set as
+/// part of the batched copy, using host memory owned by the batch object. So
+/// the batch must outlive all (asynchronous) copies performed from it.
+///
+/// The segments of a batch should not overlap on their target side, as the
+/// order of their execution is not guaranteed.
+///
+class VECMEM_CORE_EXPORT copy_batch {
+
+public:
+    /// Type describing a single copy segment
+    typedef copy::segment segment;
+    /// Size type used for resizable views
+    typedef data::vector_view<char>::size_type size_type;
+
+    /// Constructor with the copy object used to query sizes with
+    copy_batch(const copy& engine);
+
+    /// Add a "raw" memory copy to the batch
+    copy_batch& add(std::size_t size, const void* from, void* to);
+
+    /// Add a 1-dimensional vector copy to the batch
+    template <typename TYPE1, typename TYPE2>
+    copy_batch& add(const data::vector_view<TYPE1>& from,
+                    data::vector_view<TYPE2> to);
+
+    /// Add a jagged vector copy to the batch
+    template <typename TYPE1, typename TYPE2>
+    copy_batch& add(const data::jagged_vector_view<TYPE1>& from,
+                    data::jagged_vector_view<TYPE2> to);
+
+    /// Access the (not yet merged) segments collected in the batch
+    const std::vector<segment>& segments() const;
+    /// Check whether the batch is empty
+    bool empty() const;
+    /// Remove all segments from the batch
+    void clear();
+
+private:
+    /// The copy object used to query the sizes of resizable views
+    const copy& m_copy;
+    /// The collected copy segments
+    std::vector<segment> m_segments;
+    /// Host memory holding the sizes to be set for resizable targets
+    std::vector<std::vector<size_type> > m_sizes;
+
+};  // class copy_batch
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/copy_batch.ipp"
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
@@ -0,0 +1,230 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+/// Pre-recorded set of memory copies and memory filling operations
+///
+/// Transferring the same set of containers, with the same shapes, over and
+/// over again does not need the sizes, capacities and contiguity of the
+/// containers to be re-derived for every transfer. A plan records the
+/// resolved "raw" operations once, which can then be replayed with
+/// @c vecmem::copy::operator() as many times as necessary.
+///
+/// The addresses of the operations are stored relative to "bindings". Every
+/// view added to the plan gets its own binding, which can later be pointed
+/// at a different view with the same layout using @c rebind.
+///
+/// Resizable sources are copied with their full capacity (and their size
+/// variables), so the plan stays valid as the sizes of such sources change.
+/// When the target of such a copy has a larger capacity than the source, the
+/// size variables are read back and limited to the capacity of the source
+/// during the replay, which makes the replay wait for the preceding
+/// operations of the copy object.
+/// The sizes of fixed sized sources are recorded into memory owned by the
+/// plan, so the plan must outlive all (asynchronous) replays of it.
+///
+/// When replayed, all memory filling operations are performed before the
+/// copies.
+///
+class VECMEM_CORE_EXPORT copy_plan {
+
+public:
+    /// Type describing a single copy segment
+    typedef copy::segment segment;
+    /// Size type used for resizable views
+    typedef data::vector_view<char>::size_type size_type;
+    /// Identifier of a binding
+    typedef std::size_t binding_id;
+
+    /// The bindings created for a copy operation
+    struct binding_pair {
+        /// Binding of the source view
+        binding_id from;
+        /// Binding of the target view
+        binding_id to;
+    };  // struct binding_pair
+
+    /// Description of a memory filling operation
+    struct fill {
+        /// The number of bytes to fill
+        std::size_t size;
+        /// The (start of the) memory block to fill
+        void* ptr;
+        /// The value to fill the memory with
+        int value;
+    };  // struct fill
+
+    /// Description of copying the size variables of resizable views
+    ///
+    /// The sizes are limited to the capacities of the source views while
+    /// being copied.
+    ///
+    struct size_copy {
+        /// The number of size variables to copy
+        std::size_t count;
+        /// The (first) size variable of the source
+        const size_type* from;
+        /// The (first) size variable of the target
+        size_type* to;
+        /// The capacities of the source views, in host memory
+        const size_type* capacities;
+    };  // struct size_copy
+
+    /// Record a 1-dimensional vector copy
+    template <typename TYPE1, typename TYPE2>
+    binding_pair add(const data::vector_view<TYPE1>& from,
+                     data::vector_view<TYPE2> to);
+
+    /// Record a jagged vector copy
+    template <typename TYPE1, typename TYPE2>
+    binding_pair add(const data::jagged_vector_view<TYPE1>& from,
+                     data::jagged_vector_view<TYPE2> to);
+
+    /// Record filling a 1-dimensional vector's memory
+    template <typename TYPE>
+    binding_id memset(data::vector_view<TYPE> data, int value);
+
+    /// Point a binding at a different 1-dimensional view
+    template <typename TYPE>
+    void rebind(binding_id id, const data::vector_view<TYPE>& data);
+
+    /// Point a binding at a different jagged view
+    template <typename TYPE>
+    void rebind(binding_id id, const data::jagged_vector_view<TYPE>& data);
+
+    /// Get the number of bindings of the plan
+    std::size_t bindings() const;
+
+    /// Get the resolved (and merged) copy segments of the plan
+    const std::vector<segment>& segments() const;
+    /// Get the resolved memory filling operations of the plan
+    const std::vector<fill>& fills() const;
+    /// Get the resolved size copies of the plan
+    const std::vector<size_copy>& size_copies() const;
+
+    /// Check whether the plan is empty
+    bool empty() const;
+
+private:
+    /// A memory address, relative to one of the bindings
+    struct endpoint {
+        /// The binding that the address is relative to
+        binding_id binding;
+        /// The offset of the address from the binding's base address
+        std::uintptr_t offset;
+    };  // struct endpoint
+
+    /// A recorded copy operation
+    struct copy_op {
+        /// The number of bytes to copy
+        std::size_t size;
+        /// The source of the copy
+        endpoint from;
+        /// The target of the copy
+        endpoint to;
+    };  // struct copy_op
+
+    /// A recorded memory filling operation
+    struct fill_op {
+        /// The number of bytes to fill
+        std::size_t size;
+        /// The memory to fill
+        endpoint ptr;
+        /// The value to fill the memory with
+        int value;
+    };  // struct fill_op
+
+    /// A recorded size copy
+    struct size_copy_op {
+        /// The number of size variables to copy
+        std::size_t count;
+        /// The source of the copy
+        endpoint from;
+        /// The target of the copy
+        endpoint to;
+        /// The index of the source capacities in @c m_sizes
+        std::size_t capacities;
+    };  // struct size_copy_op
+
+    /// Create a new binding with a given base address
+    binding_id add_binding(std::uintptr_t base);
+    /// Change the base address of an existing binding
+    void set_binding(binding_id id, std::uintptr_t base);
+    /// Create an endpoint for an address, relative to a binding
+    endpoint make_endpoint(binding_id id, const void* ptr) const;
+    /// Record a copy operation
+    void add_copy(std::size_t size, binding_id from_id, const void* from,
+                  binding_id to_id, void* to);
+    /// Record a size copy, limiting the sizes to some capacities
+    void add_size_copy(std::vector<size_type>&& capacities,
+                       binding_id from_id, const size_type* from,
+                       binding_id to_id, size_type* to);
+
+    /// Get the base address of a 1-dimensional view
+    template <typename TYPE>
+    static std::uintptr_t base_of(const data::vector_view<TYPE>& data);
+    /// Get the base address of a jagged view
+    template <typename TYPE>
+    static std::uintptr_t base_of(
+        const data::jagged_vector_view<TYPE>& data);
+
+    /// Resolve the operations into absolute addresses
+    void resolve() const;
+
+    /// The base addresses of the bindings
+    std::vector<std::uintptr_t> m_bindings;
+    /// The recorded copy operations
+    std::vector<copy_op> m_copies;
+    /// The recorded memory filling operations
+    std::vector<fill_op> m_fills;
+    /// The recorded size copies
+    std::vector<size_copy_op> m_size_copies;
+    /// Host memory holding the sizes to be set for resizable targets, and
+    /// the capacities used by the size copies
+    std::vector<std::vector<size_type> > m_sizes;
+
+    /// Flag showing whether the resolved operations are up to date
+    mutable bool m_resolved = false;
+    /// The resolved copy segments
+    mutable std::vector<segment> m_resolved_segments;
+    /// The resolved memory filling operations
+    mutable std::vector<fill> m_resolved_fills;
+    /// The resolved size copies
+    mutable std::vector<size_copy> m_resolved_size_copies;
+
+};  // class copy_plan
+
+}  // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/impl/copy_plan.ipp"
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
@@ -0,0 +1,65 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/codec.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+/// Codec for (mostly) sorted integers, using delta encoding and bit-packing
+///
+/// The data is interpreted as an array of 32- or 64-bit integers. The
+/// differences of consecutive elements are zig-zag encoded (so that small
+/// negative differences would also stay small), and then stored in blocks of
+/// 128 elements, using just as many bits per element as necessary for the
+/// largest difference in the block.
+///
+class VECMEM_CORE_EXPORT delta_bitpack_codec : public codec {
+
+public:
+    /// Constructor with the element size and chunk size to use
+    ///
+    /// @param element_size The size of the integers, 4 or 8
+    /// @param chunk_size The size of the independently compressed chunks,
+    ///        which is rounded down to a multiple of @c element_size
+    ///
+    delta_bitpack_codec(std::size_t element_size = 4,
+                        std::size_t chunk_size = default_chunk_size);
+
+    /// Get the size of the integers
+    std::size_t element_size() const;
+
+protected:
+    /// @name Function(s) implementing @c vecmem::codec
+    /// @{
+
+    /// Get the maximal compressed size of a single chunk
+    virtual std::size_t do_max_compressed_size(
+        std::size_t size) const override;
+    /// Compress a single chunk
+    virtual std::size_t do_compress(const void* in, std::size_t size,
+                                    void* out,
+                                    std::size_t capacity) const override;
+    /// Decompress a single chunk
+    virtual void do_decompress(const void* in, std::size_t compressed_size,
+                               void* out, std::size_t size) const override;
+
+    /// @}
+
+private:
+    /// The size of the integers
+    std::size_t m_element_size;
+
+};  // class delta_bitpack_codec
+
+}  // namespace vecmem
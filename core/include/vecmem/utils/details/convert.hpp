@@ -0,0 +1,67 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace vecmem {
+namespace details {
+
+/// Convert an array of elements into an array of a different type
+///
+/// The loop is kept as simple as possible (no aliasing, no branches), so
+/// that the compiler would vectorize it for the usual arithmetic types.
+///
+/// It is used by @c vecmem::copy::convert, it is not meant to be used by
+/// clients of the library directly.
+///
+template <typename TYPE1, typename TYPE2>
+void convert(const TYPE1* __restrict from, TYPE2* __restrict to,
+             std::size_t size) {
+
+    for (std::size_t i = 0; i < size; ++i) {
+        to[i] = static_cast<TYPE2>(from[i]);
+    }
+}
+
+/// Convert an array of elements, possibly using multiple threads
+///
+/// @param pool The thread pool to use, may be @c nullptr
+/// @param min_chunk The minimum number of elements to process in one task
+///
+template <typename TYPE1, typename TYPE2>
+void convert(const TYPE1* from, TYPE2* to, std::size_t size, thread_pool* pool,
+             std::size_t min_chunk = 256 * 1024) {
+
+    // Decide how many tasks to use.
+    const std::size_t n_tasks =
+        (pool == nullptr)
+            ? 1
+            : std::min(pool->size() + 1, std::max<std::size_t>(
+                                             size / min_chunk, 1));
+    if (n_tasks < 2) {
+        convert(from, to, size);
+        return;
+    }
+
+    // Convert the elements in parallel.
+    pool->parallel_for(n_tasks, [&](std::size_t i) {
+        const std::size_t begin = i * size / n_tasks;
+        const std::size_t end = (i + 1) * size / n_tasks;
+        convert(from + begin, to + begin, end - begin);
+    });
+}
+
+}  // namespace details
+}  // namespace vecmem
@@ -0,0 +1,74 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <memory>
+#include <type_traits>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+// Forward declaration(s).
+struct abstract_event;
+class event_pool;
+
+namespace details {
+
+/// Deleter used by @c vecmem::event_ptr
+///
+/// Events are either deleted, handed back to the @c vecmem::event_pool that
+/// they came from, or left alone (for statically allocated events).
+///
+class VECMEM_CORE_EXPORT event_deleter {
+
+public:
+    /// Default constructor, deleting the events
+    event_deleter() = default;
+    /// Conversion from @c std::default_delete, deleting the events
+    ///
+    /// It allows @c std::unique_ptr<EVENT> objects to be converted into
+    /// @c vecmem::event_ptr implicitly.
+    ///
+    template <typename EVENT,
+              typename = std::enable_if_t<
+                  std::is_convertible<EVENT*, abstract_event*>::value>>
+    event_deleter(const std::default_delete<EVENT>&) {}
+    /// Constructor recycling the events into a pool
+    explicit event_deleter(std::shared_ptr<event_pool> pool);
+
+    /// Create a deleter that does not touch the events at all
+    static event_deleter non_owning();
+
+    /// Delete/recycle an event
+    void operator()(abstract_event* event) const;
+
+private:
+    /// The pool to recycle the events into
+    std::shared_ptr<event_pool> m_pool;
+    /// Flag showing whether the events are owned by the pointer
+    bool m_owning = true;
+
+};  // class event_deleter
+
+}  // namespace details
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
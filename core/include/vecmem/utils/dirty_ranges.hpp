@@ -0,0 +1,88 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+/// Tracker of the modified ("dirty") index ranges of a container
+///
+/// It is used to transfer only the modified parts of a container with
+/// @c vecmem::copy::update. Ranges that are closer to each other than the
+/// "merge gap" are merged together, as copying a few unmodified elements is
+/// usually cheaper than issuing an additional copy operation.
+///
+class VECMEM_CORE_EXPORT dirty_ranges {
+
+public:
+    /// Size type used for the indices
+    typedef std::size_t size_type;
+
+    /// Description of a half-open index range
+    struct range {
+        /// The first index of the range
+        size_type begin;
+        /// The index one past the last element of the range
+        size_type end;
+    };  // struct range
+
+    /// Constructor with the merge gap (in number of elements)
+    dirty_ranges(size_type merge_gap = 0);
+
+    /// Mark a single element as modified
+    void mark(size_type index);
+    /// Mark the half-open range [begin, end) as modified
+    void mark(size_type begin, size_type end);
+
+    /// Check whether any element was marked as modified
+    bool empty() const;
+    /// Forget about all modifications
+    void clear();
+
+    /// Get the sorted and merged list of modified ranges
+    const std::vector<range>& ranges() const;
+
+    /// Get the merge gap (in number of elements)
+    size_type merge_gap() const;
+    /// Set the merge gap (in number of elements)
+    void set_merge_gap(size_type gap);
+
+private:
+    /// Sort and merge the recorded ranges
+    void compact() const;
+
+    /// The maximal gap between two ranges that would be merged
+    size_type m_merge_gap;
+    /// The recorded ranges
+    mutable std::vector<range> m_ranges;
+    /// The number of ranges at the time of the last compaction
+    mutable std::size_t m_compacted = 0;
+    /// Flag showing whether the ranges are sorted and merged
+    mutable bool m_sorted = true;
+
+};  // class dirty_ranges
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
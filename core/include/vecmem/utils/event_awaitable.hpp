@@ -0,0 +1,90 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/event_composition.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// The awaitables are only available with C++20 coroutine support.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+
+// System include(s).
+#include <coroutine>
+#include <utility>
+
+namespace vecmem {
+
+/// Awaitable adaptor for events
+///
+/// Awaiting on it suspends the coroutine until the event is complete, at
+/// which point the coroutine is resumed by the thread noticing the
+/// completion (see @c vecmem::on_ready), or on a thread pool. No thread is
+/// blocked while the coroutine is suspended.
+///
+/// Errors of the event are re-thrown from the @c co_await expression.
+///
+class event_awaiter {
+
+public:
+    /// Constructor with the event to await, and the pool to resume on
+    explicit event_awaiter(event_ptr event, thread_pool* pool = nullptr)
+        : m_event(std::move(event)), m_pool(pool) {}
+
+    /// Check whether the coroutine needs to be suspended at all
+    bool await_ready() const { return m_event->is_ready(); }
+    /// Arrange for the coroutine to be resumed once the event is complete
+    void await_suspend(std::coroutine_handle<> handle) {
+        thread_pool* pool = m_pool;
+        on_ready(*m_event, [handle, pool]() {
+            if (pool != nullptr) {
+                pool->submit([handle]() { handle.resume(); });
+            } else {
+                handle.resume();
+            }
+        });
+    }
+    /// Finish the awaiting, re-throwing the event's error (if any)
+    void await_resume() { m_event->wait(); }
+
+private:
+    /// The event being awaited
+    event_ptr m_event;
+    /// The thread pool to resume the coroutine on
+    thread_pool* m_pool;
+
+};  // class event_awaiter
+
+/// Make it possible to @c co_await events (like the ones of copy operations)
+inline event_awaiter operator co_await(event_ptr&& event) {
+
+    return event_awaiter(std::move(event));
+}
+
+/// Await an event, resuming the awaiting coroutine on a thread pool
+///
+/// Since the thread noticing the completion of an event may be a thread
+/// that should not be kept busy (for instance the worker processing the
+/// queue of a @c vecmem::host::async_copy object), it is often better to
+/// resume the coroutine on a thread pool. Like:
+///
+/// @code
+/// co_await vecmem::resume_on(copy(from, to), pool);
+/// @endcode
+///
+inline event_awaiter resume_on(event_ptr event, thread_pool& pool) {
+
+    return event_awaiter(std::move(event), &pool);
+}
+
+}  // namespace vecmem
+
+#endif  // __has_include(<coroutine>)
+#endif  // __cpp_impl_coroutine
@@ -0,0 +1,76 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <functional>
+#include <vector>
+
+namespace vecmem {
+
+/// Combine a set of events into one that completes once all of them did
+///
+/// If all of the events are @c vecmem::host_event objects, the result is
+/// completed (and its callbacks are run) by the thread completing the last
+/// input event. Otherwise the result waits on / polls the input events one
+/// by one.
+///
+/// Waiting on the result re-throws the first error encountered.
+///
+VECMEM_CORE_EXPORT
+event_ptr when_all(std::vector<event_ptr> events);
+
+/// Combine a set of events into one that completes once any of them did
+///
+/// If all of the events are @c vecmem::host_event objects, the result is
+/// completed by the thread completing the first input event. Otherwise
+/// waiting on the result polls the input events, with an increasing delay
+/// between the checks.
+///
+/// @throw std::invalid_argument If no events are given
+///
+VECMEM_CORE_EXPORT
+event_ptr when_any(std::vector<event_ptr> events);
+
+/// Run a function on a thread pool once an event is complete
+///
+/// The function is submitted to the pool once the event completes, as
+/// detected by @c vecmem::on_ready. So none of the pool's workers are
+/// blocked while waiting for the event.
+///
+/// @param event The event to wait for
+/// @param callback The function to call once @c event is complete
+/// @param pool The thread pool to run @c callback on
+/// @return An event that completes once @c callback has run. Waiting on it
+///         re-throws the error of @c event or @c callback, if there was one.
+///         (@c callback is not run if @c event failed.)
+///
+VECMEM_CORE_EXPORT
+event_ptr then(event_ptr event, std::function<void()> callback,
+               thread_pool& pool);
+
+/// Call a function once an event is complete, without blocking on it
+///
+/// For @c vecmem::host_event objects the function is called by the thread
+/// completing the event. All other event types are checked periodically
+/// (with @c vecmem::abstract_event::is_ready) by a single, shared watcher
+/// thread, which then calls the function. In both cases the function is
+/// called right away if the event is already complete.
+///
+/// The event must stay alive until the function is called. The function
+/// must not throw.
+///
+VECMEM_CORE_EXPORT
+void on_ready(abstract_event& event, std::function<void()> callback);
+
+}  // namespace vecmem
@@ -0,0 +1,83 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+/// Thread-safe pool of re-usable events
+///
+/// Backends for which creating/destroying events is expensive can keep their
+/// used events in such a pool, and re-use them for later operations. Events
+/// handed out with @c make_pooled are returned to the pool automatically
+/// when they are released.
+///
+/// The pool must be managed by a @c std::shared_ptr. Pooled events keep the
+/// pool alive, so they may outlive the object that created them.
+///
+class VECMEM_CORE_EXPORT event_pool
+    : public std::enable_shared_from_this<event_pool> {
+
+public:
+    /// Constructor with the maximal number of events to keep
+    event_pool(std::size_t max_size = 64);
+    /// Destructor
+    ~event_pool();
+
+    /// Disallow copying the object
+    event_pool(const event_pool&) = delete;
+    /// Disallow copying the object
+    event_pool& operator=(const event_pool&) = delete;
+
+    /// Take a previously used event out of the pool
+    ///
+    /// @return A previously used event, or @c nullptr if the pool is empty
+    ///
+    std::unique_ptr<abstract_event> acquire();
+
+    /// Wrap an event into a pointer that would return it to this pool
+    event_ptr make_pooled(std::unique_ptr<abstract_event> event);
+
+    /// Return an event to the pool (deleting it if the pool is full)
+    void release(abstract_event* event);
+
+    /// Get the number of events currently in the pool
+    std::size_t size() const;
+
+private:
+    /// The maximal number of events to keep
+    std::size_t m_max_size;
+    /// Mutex protecting the events
+    mutable std::mutex m_mutex;
+    /// The events available for re-use
+    std::vector<std::unique_ptr<abstract_event> > m_events;
+
+};  // class event_pool
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
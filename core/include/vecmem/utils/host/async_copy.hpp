@@ -0,0 +1,117 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem::host {
+
+// Forward declaration(s).
+namespace details {
+struct async_copy_queue;
+}
+
+/// Specialisation of @c vecmem::copy performing host copies asynchronously
+///
+/// This specialisation of @c vecmem::copy, like @c vecmem::cuda::async_copy
+/// and @c vecmem::sycl::async_copy, performs its operations asynchronously.
+/// The operations are executed by the workers of a @c vecmem::thread_pool,
+/// in the order in which they were issued. (Every object behaves like a
+/// CUDA stream / in-order SYCL queue.) The events returned by the object
+/// complete once all operations issued before them have finished.
+///
+/// Small operations are performed on the calling thread, after waiting for
+/// all previously issued operations to finish. (Much like how CUDA handles
+/// copies from pageable host memory.) Which also means that the sources of
+/// such small copies do not need to outlive the call. The sources of the
+/// large copies have to stay valid until the operation's event completes.
+/// (Temporary buffers used internally by @c vecmem::copy are copied into the
+/// queued operations.)
+///
+/// Errors encountered by the asynchronous operations are reported by the
+/// next event created by the object.
+///
+/// The class can only be used with host-accessible memory.
+///
+class VECMEM_CORE_EXPORT async_copy : public vecmem::copy {
+
+public:
+    /// Configuration for the copy engine
+    struct config {
+        /// Operations up to this size (in bytes) run on the calling thread
+        std::size_t sync_threshold = 64 * 1024;
+    };  // struct config
+
+    /// Constructor with the number of threads to use
+    ///
+    /// @param n_threads The number of worker threads to start in a private
+    ///        thread pool. With 0, the number of hardware threads is used.
+    ///
+    async_copy(std::size_t n_threads = 1);
+    /// Constructor with the number of threads, and a custom configuration
+    async_copy(std::size_t n_threads, const config& cfg);
+    /// Constructor with an externally owned thread pool
+    async_copy(thread_pool& pool);
+    /// Constructor with an externally owned thread pool, and a configuration
+    async_copy(thread_pool& pool, const config& cfg);
+    /// Destructor, waiting for all issued operations to finish
+    ~async_copy();
+
+    /// Get the configuration of the object
+    const config& get_config() const;
+
+protected:
+    /// Perform an asynchronous memory copy
+    virtual void do_copy(std::size_t size, const void* from, void* to,
+                         type::copy_type cptype) const override;
+    /// Perform a batch of memory copies asynchronously
+    virtual void do_copy_batch(const std::vector<segment>& segments,
+                               type::copy_type cptype) const override;
+    /// Perform an asynchronous memory copy from a temporary host buffer
+    virtual void do_copy_temporary(std::size_t size, const void* from,
+                                   void* to,
+                                   type::copy_type cptype) const override;
+    /// Fill a memory area asynchronously
+    virtual void do_memset(std::size_t size, void* ptr,
+                           int value) const override;
+    /// Create an event for synchronization
+    virtual event_type create_event() const override;
+
+private:
+    /// Thread pool owned by this object (if any)
+    std::unique_ptr<thread_pool> m_owned_pool;
+    /// The thread pool used by the object
+    thread_pool& m_pool;
+    /// The configuration of the object
+    config m_config;
+    /// The queue of the issued operations
+    std::shared_ptr<details::async_copy_queue> m_queue;
+
+};  // class async_copy
+
+}  // namespace vecmem::host
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
@@ -0,0 +1,95 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <exception>
+#include <functional>
+#include <memory>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+// Forward declaration(s).
+namespace details {
+struct host_event_state;
+}
+
+/// Event completed explicitly by the host code producing it
+///
+/// Objects of this type are handles to a shared state. Copies of a handle
+/// refer to the same event, so the producer of an operation can keep one
+/// copy to @c complete, while handing another copy to the consumer of the
+/// operation.
+///
+/// Unlike the events of the device backends, it allows functions to be
+/// attached to it, which are called as soon as the event is completed.
+///
+class VECMEM_CORE_EXPORT host_event : public abstract_event {
+
+public:
+    /// Default constructor, creating a new, not yet complete event
+    host_event();
+    /// Destructor
+    ~host_event();
+
+    /// @name Function(s) implementing @c vecmem::abstract_event
+    /// @{
+
+    /// Block the current thread until the event is complete
+    ///
+    /// If the event was completed with an error, the error is re-thrown.
+    ///
+    virtual void wait() override;
+    /// Check whether the event is complete
+    virtual bool is_ready() override;
+
+    /// @}
+
+    /// Mark the event as (successfully) complete
+    ///
+    /// All callbacks attached to the event are run by the calling thread.
+    /// Completing an event that is already complete has no effect.
+    ///
+    void complete() const;
+    /// Mark the event as complete, with an error
+    void complete(std::exception_ptr error) const;
+
+    /// Attach a function to be called once the event is complete
+    ///
+    /// The function is called by the thread completing the event, or
+    /// right away by the calling thread if the event is already complete.
+    /// It must not throw.
+    ///
+    void then(std::function<void()> callback) const;
+
+    /// Get the error that the event was completed with (if any)
+    std::exception_ptr error() const;
+
+private:
+    /// The state shared between the copies of the event
+    std::shared_ptr<details::host_event_state> m_state;
+
+};  // class host_event
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
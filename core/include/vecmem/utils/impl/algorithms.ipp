@@ -0,0 +1,423 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/details/parallel_scan.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace vecmem {
+namespace algorithms {
+namespace details {
+
+/// Get the number of blocks to split a range of a given length into
+inline std::size_t n_blocks(thread_pool& pool, std::size_t n) {
+
+    return vecmem::details::parallel_scan_blocks(n, &pool);
+}
+
+/// Execute a function on contiguous blocks of a range
+template <typename FUNC>
+void for_blocks(thread_pool& pool, std::size_t n, std::size_t n_blocks,
+                const FUNC& func) {
+
+    vecmem::details::parallel_scan_for_blocks(n, n_blocks, &pool, func);
+}
+
+/// Prepare an output view for receiving a given number of elements
+template <typename TYPE>
+void set_output_size(data::vector_view<TYPE>& output,
+                     typename data::vector_view<TYPE>::size_type size) {
+
+    if (output.capacity() < size) {
+        std::ostringstream msg;
+        msg << "output.capacity() (" << output.capacity() << ") < " << size;
+        throw std::length_error(msg.str());
+    }
+    if (output.size_ptr() != nullptr) {
+        *(output.size_ptr()) = size;
+    }
+}
+
+/// Implementation of the inclusive and exclusive scans
+template <bool INCLUSIVE, typename TYPE1, typename TYPE2, typename BINARY_OP>
+std::remove_cv_t<TYPE2> scan(thread_pool& pool,
+                             const data::vector_view<TYPE1>& input,
+                             data::vector_view<TYPE2>& output,
+                             std::remove_cv_t<TYPE2> init, BINARY_OP op) {
+
+    // Helper type definition(s).
+    typedef std::remove_cv_t<TYPE2> value_type;
+
+    // Set up the output.
+    const std::size_t n = input.size();
+    set_output_size(output,
+                    static_cast<typename data::vector_view<TYPE2>::size_type>(
+                        n));
+    const auto in = input.ptr();
+    const auto out = output.ptr();
+
+    // Calculate the reduction of every block, and from them the value that
+    // every block needs to start from. An inclusive scan has no initial
+    // value, so the blocks without any preceding elements have to start
+    // without one.
+    const std::size_t nb = n_blocks(pool, n);
+    std::vector<value_type> block_init(nb, init);
+    std::vector<char> has_init(nb, (INCLUSIVE ? 0 : 1));
+    value_type total = init;
+    bool has_total = !INCLUSIVE;
+    if (nb > 1) {
+        std::vector<value_type> block_sum(nb);
+        std::vector<char> has_sum(nb, 0);
+        for_blocks(pool, n, nb,
+                   [&](std::size_t block, std::size_t begin, std::size_t end) {
+                       if (begin == end) {
+                           return;
+                       }
+                       value_type sum = in[begin];
+                       for (std::size_t i = begin + 1; i < end; ++i) {
+                           sum = op(sum, in[i]);
+                       }
+                       block_sum[block] = sum;
+                       has_sum[block] = 1;
+                   });
+        for (std::size_t block = 0; block < nb; ++block) {
+            block_init[block] = total;
+            has_init[block] = has_total;
+            if (has_sum[block]) {
+                total = (has_total ? op(total, block_sum[block])
+                                   : block_sum[block]);
+                has_total = true;
+            }
+        }
+    }
+
+    // Write the output.
+    for_blocks(pool, n, nb,
+               [&](std::size_t block, std::size_t begin, std::size_t end) {
+                   if (begin == end) {
+                       return;
+                   }
+                   value_type acc = block_init[block];
+                   if (INCLUSIVE) {
+                       acc = (has_init[block] ? op(acc, in[begin])
+                                              : value_type(in[begin]));
+                       out[begin] = acc;
+                       for (std::size_t i = begin + 1; i < end; ++i) {
+                           acc = op(acc, in[i]);
+                           out[i] = acc;
+                       }
+                   } else {
+                       for (std::size_t i = begin; i < end; ++i) {
+                           const value_type value = in[i];
+                           out[i] = acc;
+                           acc = op(acc, value);
+                       }
+                   }
+                   if (nb == 1) {
+                       total = acc;
+                   }
+               });
+    return total;
+}
+
+/// Traits for turning values into unsigned integer keys for a radix sort
+///
+/// The keys are constructed such that their ordering would be the same as
+/// the ordering of the original values.
+///
+template <typename TYPE, typename ENABLE = void>
+struct radix_traits;
+
+/// Traits for unsigned integral types
+template <typename TYPE>
+struct radix_traits<TYPE, std::enable_if_t<std::is_integral<TYPE>::value &&
+                                           std::is_unsigned<TYPE>::value> > {
+    typedef TYPE key_type;
+    static key_type key(TYPE value) { return value; }
+};
+
+/// Traits for signed integral types
+template <typename TYPE>
+struct radix_traits<TYPE, std::enable_if_t<std::is_integral<TYPE>::value &&
+                                           std::is_signed<TYPE>::value> > {
+    typedef std::make_unsigned_t<TYPE> key_type;
+    static key_type key(TYPE value) {
+        // Flip the sign bit, to put negative values before positive ones.
+        return static_cast<key_type>(
+            static_cast<key_type>(value) ^
+            (key_type(1) << (std::numeric_limits<key_type>::digits - 1)));
+    }
+};
+
+/// Traits for floating point types
+template <typename TYPE>
+struct radix_traits<TYPE,
+                    std::enable_if_t<std::is_floating_point<TYPE>::value> > {
+    static_assert((sizeof(TYPE) == 4) || (sizeof(TYPE) == 8),
+                  "Only 32- and 64-bit floating point types are supported");
+    typedef std::conditional_t<sizeof(TYPE) == 4, std::uint32_t,
+                               std::uint64_t>
+        key_type;
+    static key_type key(TYPE value) {
+        key_type bits = 0;
+        std::memcpy(&bits, &value, sizeof(TYPE));
+        // Flip all bits of negative values, to reverse their ordering, and
+        // only the sign bit of positive ones.
+        static constexpr key_type sign_bit =
+            key_type(1) << (std::numeric_limits<key_type>::digits - 1);
+        return ((bits & sign_bit) ? static_cast<key_type>(~bits)
+                                  : static_cast<key_type>(bits | sign_bit));
+    }
+};
+
+}  // namespace details
+
+template <typename TYPE, typename T, typename BINARY_OP>
+T reduce(thread_pool& pool, const data::vector_view<TYPE>& view, T init,
+         BINARY_OP op) {
+
+    // Reduce every block separately.
+    const std::size_t n = view.size();
+    const std::size_t nb = details::n_blocks(pool, n);
+    const auto ptr = view.ptr();
+    std::vector<T> block_sum(nb);
+    std::vector<char> has_sum(nb, 0);
+    details::for_blocks(
+        pool, n, nb,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            if (begin == end) {
+                return;
+            }
+            T sum = ptr[begin];
+            for (std::size_t i = begin + 1; i < end; ++i) {
+                sum = op(sum, ptr[i]);
+            }
+            block_sum[block] = sum;
+            has_sum[block] = 1;
+        });
+
+    // Combine the results of the blocks.
+    T result = init;
+    for (std::size_t block = 0; block < nb; ++block) {
+        if (has_sum[block]) {
+            result = op(result, block_sum[block]);
+        }
+    }
+    return result;
+}
+
+template <typename TYPE1, typename TYPE2, typename BINARY_OP>
+void inclusive_scan(thread_pool& pool, const data::vector_view<TYPE1>& input,
+                    data::vector_view<TYPE2> output, BINARY_OP op) {
+
+    details::scan<true>(pool, input, output, std::remove_cv_t<TYPE2>{}, op);
+}
+
+template <typename TYPE1, typename TYPE2, typename BINARY_OP>
+std::remove_cv_t<TYPE2> exclusive_scan(thread_pool& pool,
+                                       const data::vector_view<TYPE1>& input,
+                                       data::vector_view<TYPE2> output,
+                                       std::remove_cv_t<TYPE2> init,
+                                       BINARY_OP op) {
+
+    return details::scan<false>(pool, input, output, init, op);
+}
+
+template <typename TYPE>
+void sort(thread_pool& pool, data::vector_view<TYPE> view) {
+
+    // Helper type definition(s).
+    static_assert(!std::is_const<TYPE>::value, "Can not sort a const view");
+    static_assert(!std::is_same<TYPE, bool>::value, "Can not sort booleans");
+    typedef details::radix_traits<TYPE> traits;
+    typedef typename traits::key_type key_type;
+    static constexpr std::size_t RADIX_BITS = 8;
+    static constexpr std::size_t RADIX = 1 << RADIX_BITS;
+
+    // Check if anything needs to be done.
+    const std::size_t n = view.size();
+    if (n < 2) {
+        return;
+    }
+
+    // Set up the temporary memory needed by the sort.
+    const std::size_t nb = details::n_blocks(pool, n);
+    std::vector<TYPE> temp(n);
+    std::vector<std::size_t> offsets(nb * RADIX);
+    TYPE* src = view.ptr();
+    TYPE* dst = temp.data();
+
+    // Sort the elements one digit at a time, starting from the least
+    // significant one.
+    for (std::size_t shift = 0; shift < sizeof(key_type) * 8;
+         shift += RADIX_BITS) {
+
+        // Count the digits in every block.
+        details::for_blocks(
+            pool, n, nb,
+            [&](std::size_t block, std::size_t begin, std::size_t end) {
+                std::array<std::size_t, RADIX> counts{};
+                for (std::size_t i = begin; i < end; ++i) {
+                    ++counts[(traits::key(src[i]) >> shift) & (RADIX - 1)];
+                }
+                std::copy(counts.begin(), counts.end(),
+                          offsets.begin() + block * RADIX);
+            });
+
+        // Turn the counts into the offsets at which the blocks write the
+        // elements with a given digit. Skipping the pass if all elements
+        // have the same digit.
+        std::size_t offset = 0;
+        bool skip = false;
+        for (std::size_t digit = 0; digit < RADIX; ++digit) {
+            const std::size_t start = offset;
+            for (std::size_t block = 0; block < nb; ++block) {
+                const std::size_t count = offsets[block * RADIX + digit];
+                offsets[block * RADIX + digit] = offset;
+                offset += count;
+            }
+            if (offset - start == n) {
+                skip = true;
+                break;
+            }
+        }
+        if (skip) {
+            continue;
+        }
+
+        // Move the elements to their new places.
+        details::for_blocks(
+            pool, n, nb,
+            [&](std::size_t block, std::size_t begin, std::size_t end) {
+                std::size_t* block_offsets = offsets.data() + block * RADIX;
+                for (std::size_t i = begin; i < end; ++i) {
+                    dst[block_offsets[(traits::key(src[i]) >> shift) &
+                                      (RADIX - 1)]++] = src[i];
+                }
+            });
+        std::swap(src, dst);
+    }
+
+    // Make sure that the result ends up in the view.
+    if (src != view.ptr()) {
+        details::for_blocks(
+            pool, n, nb, [&](std::size_t, std::size_t begin, std::size_t end) {
+                std::copy(src + begin, src + end, view.ptr() + begin);
+            });
+    }
+}
+
+template <typename TYPE, typename PREDICATE>
+typename data::vector_view<TYPE>::size_type partition(
+    thread_pool& pool, data::vector_view<TYPE> view, PREDICATE pred) {
+
+    // Helper type definition(s).
+    static_assert(!std::is_const<TYPE>::value,
+                  "Can not partition a const view");
+    typedef typename data::vector_view<TYPE>::size_type size_type;
+
+    // Evaluate the predicate for all elements, counting the selected ones
+    // in every block.
+    const std::size_t n = view.size();
+    const std::size_t nb = details::n_blocks(pool, n);
+    TYPE* ptr = view.ptr();
+    std::vector<char> flags(n);
+    std::vector<std::size_t> selected(nb + 1, 0);
+    details::for_blocks(
+        pool, n, nb,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            std::size_t count = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                flags[i] = (pred(ptr[i]) ? 1 : 0);
+                count += flags[i];
+            }
+            selected[block + 1] = count;
+        });
+    std::partial_sum(selected.begin(), selected.end(), selected.begin());
+    const std::size_t n_selected = selected.back();
+
+    // Move the elements into a temporary array, in their new order. The
+    // elements not satisfying the predicate are placed after all of the
+    // ones that do.
+    std::vector<TYPE> temp(n);
+    details::for_blocks(
+        pool, n, nb,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            std::size_t sel = selected[block];
+            std::size_t rest = n_selected + begin - sel;
+            for (std::size_t i = begin; i < end; ++i) {
+                temp[flags[i] ? sel++ : rest++] = ptr[i];
+            }
+        });
+
+    // Copy them back into the view.
+    details::for_blocks(
+        pool, n, nb, [&](std::size_t, std::size_t begin, std::size_t end) {
+            std::copy(temp.begin() + begin, temp.begin() + end, ptr + begin);
+        });
+    return static_cast<size_type>(n_selected);
+}
+
+template <typename TYPE1, typename TYPE2, typename PREDICATE>
+typename data::vector_view<TYPE2>::size_type copy_if(
+    thread_pool& pool, const data::vector_view<TYPE1>& input,
+    data::vector_view<TYPE2> output, PREDICATE pred) {
+
+    // Helper type definition(s).
+    typedef typename data::vector_view<TYPE2>::size_type size_type;
+
+    // Evaluate the predicate for all elements, counting the selected ones
+    // in every block.
+    const std::size_t n = input.size();
+    const std::size_t nb = details::n_blocks(pool, n);
+    const auto in = input.ptr();
+    std::vector<char> flags(n);
+    std::vector<std::size_t> selected(nb + 1, 0);
+    details::for_blocks(
+        pool, n, nb,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            std::size_t count = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                flags[i] = (pred(in[i]) ? 1 : 0);
+                count += flags[i];
+            }
+            selected[block + 1] = count;
+        });
+    std::partial_sum(selected.begin(), selected.end(), selected.begin());
+    const size_type n_selected = static_cast<size_type>(selected.back());
+
+    // Copy the selected elements.
+    details::set_output_size(output, n_selected);
+    const auto out = output.ptr();
+    details::for_blocks(
+        pool, n, nb,
+        [&](std::size_t block, std::size_t begin, std::size_t end) {
+            std::size_t pos = selected[block];
+            for (std::size_t i = begin; i < end; ++i) {
+                if (flags[i]) {
+                    out[pos++] = in[i];
+                }
+            }
+        });
+    return n_selected;
+}
+
+}  // namespace algorithms
+}  // namespace vecmem
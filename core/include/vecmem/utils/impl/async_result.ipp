@@ -0,0 +1,48 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <utility>
+
+namespace vecmem {
+
+template <typename TYPE>
+async_result<TYPE>::async_result(std::unique_ptr<value_type> value,
+                                 event_type event)
+    : m_value(std::move(value)), m_event(std::move(event)) {}
+
+template <typename TYPE>
+bool async_result<TYPE>::valid() const {
+
+    return static_cast<bool>(m_value);
+}
+
+template <typename TYPE>
+void async_result<TYPE>::wait() {
+
+    // Wait for the event only once.
+    if (m_event) {
+        m_event->wait();
+        m_event.reset();
+    }
+}
+
+template <typename TYPE>
+auto async_result<TYPE>::get() -> value_type& {
+
+    // A sanity check.
+    assert(valid());
+
+    // Make sure that the value is ready.
+    wait();
+    return *m_value;
+}
+
+}  // namespace vecmem
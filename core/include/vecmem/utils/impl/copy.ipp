@@ -8,17 +8,22 @@
 #pragma once
 
 // VecMem include(s).
+#include "vecmem/containers/flat_jagged_vector.hpp"
 #include "vecmem/containers/jagged_vector.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/unique_ptr.hpp"
 #include "vecmem/utils/debug.hpp"
+#include "vecmem/utils/details/convert.hpp"
 #include "vecmem/utils/type_traits.hpp"
 
 // System include(s).
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 namespace vecmem {
 
@@ -66,7 +71,7 @@ data::vector_buffer<std::remove_cv_t<TYPE>> copy::to(
 
     // Set up the result buffer.
     data::vector_buffer<std::remove_cv_t<TYPE>> result(
-        data.capacity(), get_size(data), resource);
+        data.capacity(), stored_size(data), resource);
     setup(result)->wait();
 
     // Copy the payload of the vector. Explicitly waiting for the copy to finish
@@ -77,6 +82,90 @@ data::vector_buffer<std::remove_cv_t<TYPE>> copy::to(
     return result;
 }
 
+template <typename TYPE>
+copy::event_type copy::to(const data::vector_view<TYPE>& data,
+                          data::vector_buffer<std::remove_cv_t<TYPE>>& buffer,
+                          memory_resource& resource,
+                          type::copy_type cptype) const {
+
+    // Handle empty sources separately.
+    if (data.capacity() == 0) {
+        if (buffer.size_ptr() != nullptr) {
+            // Resizable buffers can simply have their size set to zero.
+            do_memset(sizeof(typename data::vector_view<TYPE>::size_type),
+                      buffer.size_ptr(), 0);
+        } else if (buffer.capacity() != 0) {
+            buffer = data::vector_buffer<std::remove_cv_t<TYPE>>();
+        }
+        return create_event();
+    }
+
+    // Collect the copies to perform.
+    std::vector<segment> segments;
+    if (data.size_ptr() != nullptr) {
+        // Re-allocate the buffer, if it is not suitable for a resizable source.
+        if ((buffer.size_ptr() == nullptr) ||
+            (buffer.capacity() < data.capacity())) {
+            buffer = data::vector_buffer<std::remove_cv_t<TYPE>>(
+                data.capacity(), 0, resource);
+            VECMEM_DEBUG_MSG(2, "Re-allocated buffer with capacity %u",
+                             data.capacity());
+        }
+        if (buffer.capacity() == data.capacity()) {
+            // Copy the size and the full capacity of the source. (The size
+            // of an overflowed source means the same for the buffer.)
+            segments.push_back(
+                {sizeof(typename data::vector_view<TYPE>::size_type),
+                 data.size_ptr(), buffer.size_ptr()});
+        } else {
+            // The size variable of an overflowed source can not be copied
+            // as-is into a larger buffer. So read it, and only copy the
+            // elements that the source actually holds.
+            const typename data::vector_view<TYPE>::size_type size =
+                stored_size(data);
+            write_size(size, buffer.size_ptr(), cptype);
+            if (size != 0) {
+                segments.push_back(
+                    {size * sizeof(TYPE), data.ptr(), buffer.ptr()});
+                do_copy_batch(segments, cptype);
+            }
+            return create_event();
+        }
+    } else {
+        // Re-allocate the buffer, if it is not suitable for a fixed size
+        // source.
+        if ((buffer.size_ptr() != nullptr) ||
+            (buffer.capacity() != data.capacity())) {
+            buffer = data::vector_buffer<std::remove_cv_t<TYPE>>(
+                data.capacity(), resource);
+            VECMEM_DEBUG_MSG(2, "Re-allocated buffer with size %u",
+                             data.capacity());
+        }
+    }
+    segments.push_back(
+        {data.capacity() * sizeof(TYPE), data.ptr(), buffer.ptr()});
+
+    // Perform the copies in one go.
+    do_copy_batch(segments, cptype);
+
+    // Return a new event.
+    return create_event();
+}
+
+template <typename TYPE>
+async_result<data::vector_buffer<std::remove_cv_t<TYPE>>> copy::to_async(
+    const data::vector_view<TYPE>& data, memory_resource& resource,
+    type::copy_type cptype) const {
+
+    // Create the (heap-stable) result buffer.
+    auto result =
+        std::make_unique<data::vector_buffer<std::remove_cv_t<TYPE>>>();
+
+    // Perform the copy.
+    event_type event = to(data, *result, resource, cptype);
+    return {std::move(result), std::move(event)};
+}
+
 template <typename TYPE1, typename TYPE2>
 copy::event_type copy::operator()(const data::vector_view<TYPE1>& from_view,
                                   data::vector_view<TYPE2> to_view,
@@ -90,7 +179,7 @@ copy::event_type copy::operator()(const data::vector_view<TYPE1>& from_view,
 
     // Get the size of the source view.
     const typename data::vector_view<TYPE1>::size_type size =
-        get_size(from_view);
+        stored_size(from_view);
 
     // Make sure that the copy can happen.
     if (to_view.capacity() < size) {
@@ -103,13 +192,18 @@ copy::event_type copy::operator()(const data::vector_view<TYPE1>& from_view,
     // Make sure that if the target view is resizable, that it would be set up
     // for the correct size.
     if (to_view.size_ptr() != nullptr) {
-        do_copy(sizeof(typename data::vector_view<TYPE2>::size_type), &size,
-                to_view.size_ptr(), cptype);
+        do_copy_temporary(sizeof(typename data::vector_view<TYPE2>::size_type),
+                          &size, to_view.size_ptr(), cptype);
     }
 
     // Copy the payload.
     assert(size == get_size(to_view));
-    do_copy(size * sizeof(TYPE1), from_view.ptr(), to_view.ptr(), cptype);
+    if (!(compressed_copy(size * sizeof(TYPE1), from_view.ptr(),
+                          to_view.ptr(), cptype) ||
+          pipelined_copy(size * sizeof(TYPE1), from_view.ptr(), to_view.ptr(),
+                         cptype))) {
+        do_copy(size * sizeof(TYPE1), from_view.ptr(), to_view.ptr(), cptype);
+    }
 
     // Return a new event.
     return create_event();
@@ -128,12 +222,152 @@ copy::event_type copy::operator()(const data::vector_view<TYPE1>& from_view,
 
     // Figure out the size of the buffer.
     const typename data::vector_view<TYPE1>::size_type size =
-        get_size(from_view);
+        stored_size(from_view);
 
     // Make the target vector the correct size.
     to_vec.resize(size);
     // Perform the memory copy.
-    do_copy(size * sizeof(TYPE1), from_view.ptr(), to_vec.data(), cptype);
+    if (!(compressed_copy(size * sizeof(TYPE1), from_view.ptr(),
+                          to_vec.data(), cptype) ||
+          pipelined_copy(size * sizeof(TYPE1), from_view.ptr(), to_vec.data(),
+                         cptype))) {
+        do_copy(size * sizeof(TYPE1), from_view.ptr(), to_vec.data(), cptype);
+    }
+
+    // Return a new event.
+    return create_event();
+}
+
+template <typename TYPE1, typename TYPE2>
+copy::event_type copy::convert(const data::vector_view<TYPE1>& from_view,
+                               data::vector_view<TYPE2> to_view,
+                               type::copy_type cptype) const {
+
+    // Make sure that the conversion is possible.
+    static_assert(!std::is_const<TYPE2>::value,
+                  "Can not convert into a constant type");
+    static_assert(std::is_convertible<const TYPE1&, TYPE2>::value,
+                  "Can only convert between convertible types");
+
+    // Make sure that the direction of the copy is known.
+    if ((cptype != type::host_to_host) && (cptype != type::host_to_device) &&
+        (cptype != type::device_to_host)) {
+        throw std::invalid_argument(
+            "Converting copies need a host-to-device, device-to-host or "
+            "host-to-host copy type");
+    }
+
+    // Get the size of the source view.
+    const typename data::vector_view<TYPE1>::size_type size =
+        stored_size(from_view);
+
+    // Make sure that the copy can happen.
+    if (to_view.capacity() < size) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to_view.capacity() << ") < source size ("
+            << size << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Make sure that if the target view is resizable, that it would be set up
+    // for the correct size.
+    if (to_view.size_ptr() != nullptr) {
+        write_size(size, to_view.size_ptr(), cptype);
+    }
+
+    // Host memory resource used for the conversion.
+    host_memory_resource host_mr;
+    memory_resource& staging_mr =
+        ((m_staging.resource != nullptr) ? *(m_staging.resource) : host_mr);
+
+    // Perform the conversion on the appropriate side of the copy.
+    switch (cptype) {
+        case type::host_to_host:
+            details::convert(from_view.ptr(), to_view.ptr(), size,
+                             m_staging.pool);
+            break;
+        case type::host_to_device: {
+            unique_alloc_ptr<TYPE2[]> staging =
+                make_unique_alloc<TYPE2[]>(staging_mr, size);
+            details::convert(from_view.ptr(), staging.get(), size,
+                             m_staging.pool);
+            do_copy(size * sizeof(TYPE2), staging.get(), to_view.ptr(),
+                    cptype);
+            create_event()->wait();
+        } break;
+        case type::device_to_host: {
+            unique_alloc_ptr<std::remove_cv_t<TYPE1>[]> staging =
+                make_unique_alloc<std::remove_cv_t<TYPE1>[]>(staging_mr,
+                                                              size);
+            do_copy(size * sizeof(TYPE1), from_view.ptr(), staging.get(),
+                    cptype);
+            create_event()->wait();
+            details::convert(staging.get(), to_view.ptr(), size,
+                             m_staging.pool);
+        } break;
+        default:
+            assert(false);
+            break;
+    }
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2, "Converted %lu elements from %lu to %lu bytes each",
+                     static_cast<unsigned long>(size), sizeof(TYPE1),
+                     sizeof(TYPE2));
+
+    // Return a new event.
+    return create_event();
+}
+
+template <typename TYPE1, typename TYPE2>
+copy::event_type copy::update(const data::vector_view<TYPE1>& from_view,
+                              data::vector_view<TYPE2> to_view,
+                              dirty_ranges& dirty,
+                              type::copy_type cptype) const {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(std::is_same<TYPE1, TYPE2>::value ||
+                      details::is_same_nc<TYPE1, TYPE2>::value,
+                  "Can only use compatible types in the copy");
+
+    // Make sure that the copy can happen.
+    if (to_view.size_ptr() != nullptr) {
+        throw std::invalid_argument(
+            "Incremental copies can only be made into fixed sized targets");
+    }
+    const std::size_t size = from_view.capacity();
+    if (to_view.capacity() < size) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to_view.capacity()
+            << ") < source capacity (" << size << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Collect the copies of the modified ranges.
+    std::vector<segment> segments;
+    for (const dirty_ranges::range& r : dirty.ranges()) {
+        if (r.begin >= size) {
+            break;
+        }
+        const std::size_t end = std::min<std::size_t>(r.end, size);
+        segments.push_back({(end - r.begin) * sizeof(TYPE1),
+                            from_view.ptr() + r.begin,
+                            to_view.ptr() + r.begin});
+    }
+
+    // Check if anything needs to be done.
+    if (segments.empty()) {
+        dirty.clear();
+        return vecmem::copy::create_event();
+    }
+
+    // Perform the copies. Only forgetting about the modified ranges once the
+    // copies were issued successfully.
+    do_copy_batch(segments, cptype);
+    dirty.clear();
+    VECMEM_DEBUG_MSG(2, "Copied %lu modified range(s) of a %lu element vector",
+                     segments.size(), size);
 
     // Return a new event.
     return create_event();
@@ -163,6 +397,49 @@ typename data::vector_view<TYPE>::size_type copy::get_size(
     return result;
 }
 
+template <typename TYPE>
+std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes(
+    const std::vector<data::vector_view<TYPE>>& data) const {
+
+    // Wait for the asynchronous operation to finish.
+    return std::move(get_sizes_async(data).get());
+}
+
+template <typename TYPE>
+async_result<std::vector<typename data::vector_view<TYPE>::size_type>>
+copy::get_sizes_async(const std::vector<data::vector_view<TYPE>>& data) const {
+
+    // Create the (heap-stable) result vector.
+    auto result = std::make_unique<
+        std::vector<typename data::vector_view<TYPE>::size_type>>(data.size(),
+                                                                   0);
+
+    // Collect the copies for all of the resizable views, and set the sizes of
+    // the non-resizable ones right away.
+    std::vector<segment> segments;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        if (data[i].size_ptr() == nullptr) {
+            (*result)[i] = data[i].capacity();
+        } else {
+            segments.push_back(
+                {sizeof(typename data::vector_view<TYPE>::size_type),
+                 data[i].size_ptr(), result->data() + i});
+        }
+    }
+
+    // Check if anything needs to be copied.
+    if (segments.empty()) {
+        return {std::move(result), vecmem::copy::create_event()};
+    }
+
+    // Perform all of the copies in one go.
+    do_copy_batch(coalesce(std::move(segments)), type::unknown);
+    VECMEM_DEBUG_MSG(2, "Fetching the sizes of %lu vectors", data.size());
+
+    // Return the result, with an event that can be used to wait for it.
+    return {std::move(result), create_event()};
+}
+
 template <typename TYPE>
 copy::event_type copy::setup(data::jagged_vector_view<TYPE> data) const {
 
@@ -174,9 +451,7 @@ copy::event_type copy::setup(data::jagged_vector_view<TYPE> data) const {
     // "Set up" the inner vector descriptors, using the host-accessible data.
     // But only if the jagged vector buffer is resizable.
     if (data.host_ptr()[0].size_ptr() != nullptr) {
-        do_memset(
-            sizeof(typename data::vector_buffer<TYPE>::size_type) * data.size(),
-            data.host_ptr()[0].size_ptr(), 0);
+        fill_sizes(data.host_ptr(), data.size());
     }
 
     // Check if anything else needs to be done.
@@ -203,10 +478,30 @@ template <typename TYPE>
 copy::event_type copy::memset(data::jagged_vector_view<TYPE> data,
                               int value) const {
 
-    // Use a very naive/expensive implementation.
-    for (std::size_t i = 0; i < data.size(); ++i) {
-        this->memset(data.host_ptr()[i], value);
+    // Check if anything needs to be done.
+    if (data.size() == 0) {
+        return vecmem::copy::create_event();
+    }
+
+    // Fill the payload of the inner vectors, merging the memory blocks of
+    // neighbouring vectors into single operations. For jagged vector buffers
+    // this means a single operation over all of their inner memory.
+    const data::vector_view<TYPE>* inner = data.host_ptr();
+    std::size_t n_fills = 0;
+    for (std::size_t i = 0; i < data.size();) {
+        TYPE* begin = inner[i].ptr();
+        TYPE* end = begin + inner[i].capacity();
+        for (++i; (i < data.size()) && (inner[i].ptr() == end); ++i) {
+            end += inner[i].capacity();
+        }
+        if (end != begin) {
+            do_memset(static_cast<std::size_t>(end - begin) * sizeof(TYPE),
+                      begin, value);
+            ++n_fills;
+        }
     }
+    VECMEM_DEBUG_MSG(2, "Filled %lu inner vectors with %lu operation(s)",
+                     data.size(), n_fills);
 
     // Return a new event.
     return create_event();
@@ -233,6 +528,104 @@ data::jagged_vector_buffer<std::remove_cv_t<TYPE>> copy::to(
     return result;
 }
 
+template <typename TYPE>
+copy::event_type copy::to(
+    const data::jagged_vector_view<TYPE>& data,
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>>& buffer,
+    memory_resource& resource, memory_resource* host_access_resource,
+    type::copy_type cptype) const {
+
+    // Get the sizes of the source.
+    std::vector<typename data::vector_view<TYPE>::size_type> sizes =
+        get_sizes(data);
+    clamp_sizes(sizes, data.host_ptr());
+
+    // Check whether the buffer can hold the source.
+    bool reusable = (buffer.size() == data.size());
+    for (std::size_t i = 0; reusable && (i < sizes.size()); ++i) {
+        const auto& inner = buffer.host_ptr()[i];
+        reusable = ((inner.capacity() >= sizes[i]) &&
+                    ((inner.size_ptr() != nullptr) ||
+                     (inner.capacity() == sizes[i])));
+    }
+
+    // Re-allocate the buffer if necessary. Growing the capacities of the
+    // existing inner vectors, if there are any.
+    if (!reusable) {
+        std::vector<std::size_t> capacities(sizes.begin(), sizes.end());
+        if (buffer.size() == data.size()) {
+            for (std::size_t i = 0; i < capacities.size(); ++i) {
+                capacities[i] = std::max<std::size_t>(
+                    capacities[i], buffer.host_ptr()[i].capacity());
+            }
+        }
+        buffer = data::jagged_vector_buffer<std::remove_cv_t<TYPE>>(
+            std::vector<std::size_t>(sizes.size(), 0), capacities, resource,
+            host_access_resource);
+        setup(buffer)->wait();
+        VECMEM_DEBUG_MSG(2, "Re-allocated jagged buffer with %lu elements",
+                         sizes.size());
+    }
+
+    // Check if anything needs to be copied.
+    if (data.size() == 0) {
+        return vecmem::copy::create_event();
+    }
+
+    // Perform the copy.
+    return copy_jagged_impl(sizes, data, buffer, cptype);
+}
+
+template <typename TYPE>
+async_result<data::jagged_vector_buffer<std::remove_cv_t<TYPE>>>
+copy::to_async(const data::jagged_vector_view<TYPE>& data,
+               memory_resource& resource,
+               memory_resource* host_access_resource,
+               type::copy_type cptype) const {
+
+    // Create the (heap-stable) result buffer.
+    auto result =
+        std::make_unique<data::jagged_vector_buffer<std::remove_cv_t<TYPE>>>();
+
+    // Perform the copy.
+    event_type event =
+        to(data, *result, resource, host_access_resource, cptype);
+    return {std::move(result), std::move(event)};
+}
+
+template <typename TYPE>
+data::jagged_vector_buffer<std::remove_cv_t<TYPE>> copy::compact(
+    const data::jagged_vector_view<TYPE>& data, memory_resource& resource,
+    memory_resource* host_access_resource, type::copy_type cptype) const {
+
+    // Get the number of used elements in every row.
+    std::vector<typename data::vector_view<TYPE>::size_type> sizes =
+        get_sizes(data);
+    clamp_sizes(sizes, data.host_ptr());
+
+    // Create a buffer with rows of exactly these sizes.
+    data::jagged_vector_buffer<std::remove_cv_t<TYPE>> result(
+        data::vector_view<const typename data::vector_view<TYPE>::size_type>(
+            static_cast<typename data::vector_view<TYPE>::size_type>(
+                sizes.size()),
+            sizes.data()),
+        resource, host_access_resource);
+    assert(result.size() == data.size());
+
+    // Copy the description of the "inner vectors" if necessary.
+    setup(result)->wait();
+
+    // Gather the used elements of the rows. Explicitly waiting for the copy
+    // to finish before returning the buffer.
+    if (data.size() != 0) {
+        copy_jagged_impl(sizes, data, result, cptype)->wait();
+    }
+    VECMEM_DEBUG_MSG(2, "Compacted %lu inner vectors", data.size());
+
+    // Return the newly created object.
+    return result;
+}
+
 template <typename TYPE1, typename TYPE2>
 copy::event_type copy::operator()(
     const data::jagged_vector_view<TYPE1>& from_view,
@@ -253,20 +646,34 @@ copy::event_type copy::operator()(
     }
 
     // Check if anything needs to be done.
-    const std::size_t size = from_view.size();
-    if (size == 0) {
+    if (from_view.size() == 0) {
         return vecmem::copy::create_event();
     }
 
+    // Perform the copy using the sizes of the source jagged vector.
+    std::vector<typename data::vector_view<TYPE1>::size_type> sizes =
+        get_sizes(from_view);
+    clamp_sizes(sizes, from_view.host_ptr());
+    return copy_jagged_impl(sizes, from_view, to_view, cptype);
+}
+
+template <typename TYPE1, typename TYPE2>
+copy::event_type copy::copy_jagged_impl(
+    const std::vector<typename data::vector_view<TYPE1>::size_type>& sizes,
+    const data::jagged_vector_view<TYPE1>& from_view,
+    data::jagged_vector_view<TYPE2> to_view, type::copy_type cptype) const {
+
+    // A sanity check.
+    const std::size_t size = from_view.size();
+    assert(sizes.size() == size);
+    assert(size <= to_view.size());
+
     // Calculate the contiguous-ness of the memory allocations.
     const bool from_is_contiguous = is_contiguous(from_view.host_ptr(), size);
     const bool to_is_contiguous = is_contiguous(to_view.host_ptr(), size);
     VECMEM_DEBUG_MSG(3, "from_is_contiguous = %d, to_is_contiguous = %d",
                      from_is_contiguous, to_is_contiguous);
 
-    // Get the sizes of the source jagged vector.
-    const auto sizes = get_sizes(from_view);
-
     // Before even attempting the copy, make sure that the target view either
     // has the correct sizes, or can be resized correctly.
     set_sizes(sizes, to_view);
@@ -315,15 +722,48 @@ copy::event_type copy::operator()(
 
     // Resize the output object to the correct size.
     to_vec.resize(from_view.size());
-    const auto sizes = get_sizes(from_view);
+    auto sizes = get_sizes(from_view);
+    clamp_sizes(sizes, from_view.host_ptr());
     assert(sizes.size() == to_vec.size());
     for (typename data::jagged_vector_view<TYPE1>::size_type i = 0;
          i < from_view.size(); ++i) {
         to_vec[i].resize(sizes[i]);
     }
 
-    // Perform the memory copy.
-    return operator()(from_view, vecmem::get_data(to_vec), cptype);
+    // Check if anything needs to be copied.
+    if (from_view.size() == 0) {
+        return vecmem::copy::create_event();
+    }
+
+    // Perform the memory copy, re-using the sizes that were already fetched.
+    auto to_data = vecmem::get_data(to_vec);
+    return copy_jagged_impl(sizes, from_view, to_data, cptype);
+}
+
+template <typename TYPE1, typename TYPE2>
+copy::event_type copy::operator()(
+    const data::jagged_vector_view<TYPE1>& from_view,
+    flat_jagged_vector<TYPE2>& to_vec, type::copy_type cptype) const {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(std::is_same<TYPE1, TYPE2>::value ||
+                      details::is_same_nc<TYPE1, TYPE2>::value,
+                  "Can only use compatible types in the copy");
+
+    // Set up the output object with the correct row sizes.
+    auto sizes = get_sizes(from_view);
+    clamp_sizes(sizes, from_view.host_ptr());
+    to_vec.resize(sizes);
+
+    // Check if anything needs to be copied.
+    if (from_view.size() == 0) {
+        return vecmem::copy::create_event();
+    }
+
+    // Perform the memory copy, re-using the sizes that were already fetched.
+    auto to_data = vecmem::get_data(to_vec);
+    return copy_jagged_impl(sizes, from_view, to_data, cptype);
 }
 
 template <typename TYPE>
@@ -334,6 +774,47 @@ std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes(
     return get_sizes_impl(data.host_ptr(), data.size());
 }
 
+template <typename TYPE>
+std::vector<std::vector<typename data::vector_view<TYPE>::size_type>>
+copy::get_sizes(const std::vector<data::jagged_vector_view<TYPE>>& data) const {
+
+    // Wait for the asynchronous operation to finish.
+    return std::move(get_sizes_async(data).get());
+}
+
+template <typename TYPE>
+async_result<
+    std::vector<std::vector<typename data::vector_view<TYPE>::size_type>>>
+copy::get_sizes_async(
+    const std::vector<data::jagged_vector_view<TYPE>>& data) const {
+
+    // Create the (heap-stable) result vector.
+    auto result = std::make_unique<
+        std::vector<std::vector<typename data::vector_view<TYPE>::size_type>>>(
+        data.size());
+
+    // Collect the copies for all of the jagged vectors.
+    std::vector<segment> segments;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        (*result)[i].resize(data[i].size(), 0);
+        get_sizes_segments(data[i].host_ptr(), data[i].size(),
+                           (*result)[i].data(), segments);
+    }
+
+    // Check if anything needs to be copied.
+    if (segments.empty()) {
+        return {std::move(result), vecmem::copy::create_event()};
+    }
+
+    // Perform all of the copies in one go.
+    do_copy_batch(coalesce(std::move(segments)), type::unknown);
+    VECMEM_DEBUG_MSG(2, "Fetching the sizes of %lu jagged vectors",
+                     data.size());
+
+    // Return the result, with an event that can be used to wait for it.
+    return {std::move(result), create_event()};
+}
+
 template <typename TYPE>
 copy::event_type copy::set_sizes(
     const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
@@ -343,40 +824,134 @@ copy::event_type copy::set_sizes(
     if ((sizes.size() == 0) && (data.size() == 0)) {
         return vecmem::copy::create_event();
     }
-    // Make sure that the sizes match up.
-    if (sizes.size() != data.size()) {
-        throw std::runtime_error(
-            "Incorrect size vector received for target jagged vector sizes");
-    }
-    // Make sure that the target jagged vector is either resizable, or it has
-    // the correct sizes/capacities already.
-    bool perform_copy = true;
-    for (typename data::jagged_vector_view<TYPE>::size_type i = 0;
-         i < data.size(); ++i) {
-        if (data.host_ptr()[i].size_ptr() == nullptr) {
-            perform_copy = false;
-        } else if (perform_copy == true) {
-            throw std::runtime_error(
-                "Inconsistent target jagged vector view received for resizing");
-        } else if (data.host_ptr()[i].capacity() != sizes[i]) {
-            throw std::runtime_error(
-                "Non-resizable jaggged vector does not match the requested "
-                "size");
-        }
-    }
     // If no copy is necessary, we're done.
-    if (perform_copy == false) {
+    if (needs_size_update(sizes, data) == false) {
         return vecmem::copy::create_event();
     }
     // Perform the copy with some internal knowledge of how resizable jagged
     // vector buffers work.
-    do_copy(sizeof(typename data::vector_view<TYPE>::size_type) * sizes.size(),
-            sizes.data(), data.host_ptr()->size_ptr(), type::unknown);
+    do_copy_temporary(
+        sizeof(typename data::vector_view<TYPE>::size_type) * sizes.size(),
+        sizes.data(), data.host_ptr()->size_ptr(), type::unknown);
 
     // Return a new event.
     return create_event();
 }
 
+template <typename... TYPES>
+copy::event_type copy::setup(data::soa_view<TYPES...> data) const {
+
+    // Check if anything needs to be done.
+    if ((data.size_ptr() == nullptr) || (data.capacity() == 0)) {
+        return vecmem::copy::create_event();
+    }
+
+    // Initialize the (shared) "size variable" correctly on the buffer.
+    do_memset(sizeof(typename data::soa_view<TYPES...>::size_type),
+              data.size_ptr(), 0);
+    VECMEM_DEBUG_MSG(2,
+                     "Prepared a struct-of-arrays buffer of capacity %u "
+                     "for use on a device (ptr: %p)",
+                     data.capacity(), static_cast<void*>(data.size_ptr()));
+
+    // Return a new event.
+    return create_event();
+}
+
+template <typename... TYPES>
+copy::event_type copy::memset(data::soa_view<TYPES...> data,
+                              int value) const {
+
+    // Check if anything needs to be done.
+    if (data.capacity() == 0) {
+        return vecmem::copy::create_event();
+    }
+
+    // Fill the full capacity of every column of the collection.
+    std::vector<segment> segments;
+    segments.reserve(sizeof...(TYPES));
+    soa_segments(data, data, data.capacity(),
+                 std::index_sequence_for<TYPES...>{}, segments);
+    for (const segment& s : segments) {
+        do_memset(s.size, s.to, value);
+    }
+    VECMEM_DEBUG_MSG(2, "Set %lu columns of %u elements to %i",
+                     segments.size(), data.capacity(), value);
+
+    // Return a new event.
+    return create_event();
+}
+
+template <typename... TYPES1, typename... TYPES2>
+copy::event_type copy::operator()(const data::soa_view<TYPES1...>& from_view,
+                                  data::soa_view<TYPES2...> to_view,
+                                  type::copy_type cptype) const {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(sizeof...(TYPES1) == sizeof...(TYPES2),
+                  "Can only use collections with the same number of columns "
+                  "in the copy");
+    static_assert(
+        details::conjunction_v<std::is_same<std::remove_cv_t<TYPES1>,
+                                            std::remove_cv_t<TYPES2>>...>,
+        "Can only use compatible types in the copy");
+
+    // Get the size of the source collection.
+    const typename data::soa_view<TYPES1...>::size_type size =
+        stored_size(from_view);
+
+    // Make sure that the copy can happen.
+    if (to_view.capacity() < size) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to_view.capacity() << ") < source size ("
+            << size << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Make sure that if the target collection is resizable, that it would be
+    // set up for the correct size.
+    if (to_view.size_ptr() != nullptr) {
+        do_copy_temporary(
+            sizeof(typename data::soa_view<TYPES2...>::size_type), &size,
+            to_view.size_ptr(), cptype);
+    }
+
+    // Copy all of the columns in one go.
+    std::vector<segment> segments;
+    segments.reserve(sizeof...(TYPES1));
+    soa_segments(from_view, to_view, size,
+                 std::index_sequence_for<TYPES1...>{}, segments);
+    do_copy_batch(segments, cptype);
+    VECMEM_DEBUG_MSG(2, "Copied %lu columns of %u elements in one batch",
+                     segments.size(), size);
+
+    // Return a new event.
+    return create_event();
+}
+
+template <typename... TYPES>
+typename data::soa_view<TYPES...>::size_type copy::get_size(
+    const data::soa_view<TYPES...>& data) const {
+
+    // Handle the simple case, when the collection is not resizable.
+    if (data.size_ptr() == nullptr) {
+        return data.capacity();
+    }
+
+    // If it *is* resizable, don't assume that the size is host-accessible.
+    // Explicitly copy it for access.
+    typename data::soa_view<TYPES...>::size_type result = 0;
+    do_copy(sizeof(typename data::soa_view<TYPES...>::size_type),
+            data.size_ptr(), &result, type::unknown);
+
+    // Wait for the copy operation to finish.
+    create_event()->wait();
+
+    // Return what we got.
+    return result;
+}
+
 template <typename TYPE1, typename TYPE2>
 void copy::copy_views_impl(
     const std::vector<typename data::vector_view<TYPE1>::size_type>& sizes,
@@ -395,9 +970,10 @@ void copy::copy_views_impl(
 
     // Helper variable(s) used in the copy.
     const std::size_t size = sizes.size();
-    [[maybe_unused]] std::size_t copy_ops = 0;
+    std::vector<segment> segments;
+    segments.reserve(size);
 
-    // Perform the copy in multiple steps.
+    // Collect the copies of the individual "inner vectors".
     for (std::size_t i = 0; i < size; ++i) {
 
         // Skip empty "inner vectors".
@@ -411,17 +987,29 @@ void copy::copy_views_impl(
         assert(sizes[i] <= from_view[i].capacity());
         assert(sizes[i] <= to_view[i].capacity());
 
-        // Perform the copy.
-        do_copy(sizes[i] * sizeof(TYPE1), from_view[i].ptr(), to_view[i].ptr(),
-                cptype);
-        ++copy_ops;
+        // Remember the copy.
+        segments.push_back(
+            {sizes[i] * sizeof(TYPE1), from_view[i].ptr(), to_view[i].ptr()});
+    }
+
+    // Merge the copies of the "inner vectors" that happen to be next to each
+    // other in memory.
+    segments = coalesce(std::move(segments));
+
+    // Pack the copies through a staging buffer if the device side of the copy
+    // is contiguous, and it is worth it. Otherwise perform them one by one.
+    const bool stageable =
+        ((cptype == type::host_to_device) && is_contiguous(to_view, size)) ||
+        ((cptype == type::device_to_host) && is_contiguous(from_view, size));
+    if (!(stageable && staged_copy(segments, cptype))) {
+        do_copy_batch(segments, cptype);
     }
 
     // Let the user know what happened.
     VECMEM_DEBUG_MSG(2,
                      "Copied the payload of a jagged vector of type "
                      "\"%s\" with %lu copy operation(s)",
-                     typeid(TYPE2).name(), copy_ops);
+                     typeid(TYPE2).name(), segments.size());
 }
 
 template <typename TYPE1, typename TYPE2>
@@ -462,7 +1050,12 @@ void copy::copy_views_contiguous_impl(
         assert(to_view[i].ptr() != nullptr);
 
         // Perform the copy.
-        do_copy(total_size, from_view[i].ptr(), to_view[i].ptr(), cptype);
+        if (!(compressed_copy(total_size, from_view[i].ptr(),
+                              to_view[i].ptr(), cptype) ||
+              pipelined_copy(total_size, from_view[i].ptr(), to_view[i].ptr(),
+                             cptype))) {
+            do_copy(total_size, from_view[i].ptr(), to_view[i].ptr(), cptype);
+        }
         break;
     }
 
@@ -480,22 +1073,44 @@ std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes_impl(
     // Create the result vector.
     std::vector<typename data::vector_view<TYPE>::size_type> result(size, 0);
 
+    // Find out what needs to be copied, if anything.
+    std::vector<segment> segments;
+    get_sizes_segments(data, size, result.data(), segments);
+
+    // Perform the copy, if necessary.
+    for (const segment& seg : segments) {
+        do_copy(seg.size, seg.from, seg.to, type::unknown);
+    }
+    if (!segments.empty()) {
+        // Wait for the copy operation to finish. With some backends
+        // (khm... SYCL... khm...) copies can be asynchronous even into
+        // non-pinned host memory.
+        create_event()->wait();
+    }
+
+    // Return the sizes.
+    return result;
+}
+
+template <typename TYPE>
+void copy::get_sizes_segments(
+    const data::vector_view<TYPE>* data, std::size_t size,
+    typename data::vector_view<TYPE>::size_type* result,
+    std::vector<segment>& segments) {
+
     // Try to get the "resizable sizes" first.
     for (std::size_t i = 0; i < size; ++i) {
         // Find the first "inner vector" that has a non-zero capacity, and is
         // resizable.
         if ((data[i].capacity() != 0) && (data[i].size_ptr() != nullptr)) {
+            // The sizes of the inner vectors before this one are all zero.
+            std::fill(result, result + i, 0);
             // Copy the sizes of the inner vectors into the result vector.
-            do_copy(sizeof(typename data::vector_view<TYPE>::size_type) *
-                        (size - i),
-                    data[i].size_ptr(), result.data() + i, type::unknown);
-            // Wait for the copy operation to finish. With some backends
-            // (khm... SYCL... khm...) copies can be asynchronous even into
-            // non-pinned host memory.
-            create_event()->wait();
-            // At this point the result vector should have been set up
-            // correctly.
-            return result;
+            segments.push_back(
+                {sizeof(typename data::vector_view<TYPE>::size_type) *
+                     (size - i),
+                 data[i].size_ptr(), result + i});
+            return;
         }
     }
 
@@ -504,7 +1119,88 @@ std::vector<typename data::vector_view<TYPE>::size_type> copy::get_sizes_impl(
     for (std::size_t i = 0; i < size; ++i) {
         result[i] = data[i].capacity();
     }
-    return result;
+}
+
+template <typename TYPE>
+bool copy::needs_size_update(
+    const std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+    const data::jagged_vector_view<TYPE>& data) {
+
+    // Make sure that the sizes match up.
+    if (sizes.size() != data.size()) {
+        throw std::runtime_error(
+            "Incorrect size vector received for target jagged vector sizes");
+    }
+    // Nothing needs to be done for an empty jagged vector.
+    if (data.size() == 0) {
+        return false;
+    }
+    // Make sure that the target jagged vector is either resizable, or it has
+    // the correct sizes/capacities already.
+    const bool resizable = (data.host_ptr()[0].size_ptr() != nullptr);
+    for (typename data::jagged_vector_view<TYPE>::size_type i = 0;
+         i < data.size(); ++i) {
+        if ((data.host_ptr()[i].size_ptr() != nullptr) != resizable) {
+            throw std::runtime_error(
+                "Inconsistent target jagged vector view received for resizing");
+        } else if ((resizable == false) &&
+                   (data.host_ptr()[i].capacity() != sizes[i])) {
+            throw std::runtime_error(
+                "Non-resizable jaggged vector does not match the requested "
+                "size");
+        } else if (data.host_ptr()[i].capacity() < sizes[i]) {
+            throw std::runtime_error(
+                "Resizable jagged vector does not have enough capacity for "
+                "the requested size");
+        }
+    }
+    return resizable;
+}
+
+template <typename TYPE>
+void copy::fill_sizes(const data::vector_view<TYPE>* data,
+                      std::size_t size) const {
+
+    // We should never call this function for an empty jagged vector.
+    assert(size > 0);
+
+    // Zero the size variables of the vectors with one operation if they are
+    // laid out contiguously (like in jagged vector buffers), and one by one
+    // otherwise.
+    typedef typename data::vector_view<TYPE>::size_type size_type;
+    size_type* const first = data[0].size_ptr();
+    bool contiguous = true;
+    for (std::size_t i = 1; (i < size) && contiguous; ++i) {
+        contiguous = (data[i].size_ptr() == first + i);
+    }
+    if (contiguous) {
+        do_memset(sizeof(size_type) * size, first, 0);
+        return;
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i].size_ptr() != nullptr) {
+            do_memset(sizeof(size_type), data[i].size_ptr(), 0);
+        }
+    }
+}
+
+template <typename VIEW>
+auto copy::stored_size(const VIEW& data) const -> typename VIEW::size_type {
+
+    // The size variable of a resizable view may be larger than its capacity,
+    // if more elements were requested than what fits into it.
+    const typename VIEW::size_type size = get_size(data);
+    return std::min(size, data.capacity());
+}
+
+template <typename TYPE>
+void copy::clamp_sizes(
+    std::vector<typename data::vector_view<TYPE>::size_type>& sizes,
+    const data::vector_view<TYPE>* data) {
+
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        sizes[i] = std::min(sizes[i], data[i].capacity());
+    }
 }
 
 template <typename TYPE>
@@ -525,4 +1221,23 @@ bool copy::is_contiguous(const data::vector_view<TYPE>* data,
     return true;
 }
 
+template <typename... TYPES1, typename... TYPES2, std::size_t... Is>
+void copy::soa_segments(const data::soa_view<TYPES1...>& from,
+                        const data::soa_view<TYPES2...>& to, std::size_t size,
+                        std::index_sequence<Is...>,
+                        std::vector<segment>& segments) {
+
+    // Nothing needs to be copied for empty collections.
+    if (size == 0) {
+        return;
+    }
+
+    // Add one segment per column.
+    (segments.push_back(
+         {size * sizeof(typename data::soa_view<TYPES1...>::template
+                            element_type<Is>),
+          from.template ptr<Is>(), to.template ptr<Is>()}),
+     ...);
+}
+
 }  // namespace vecmem
@@ -0,0 +1,100 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/type_traits.hpp"
+
+// System include(s).
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace vecmem {
+
+template <typename TYPE1, typename TYPE2>
+copy_batch& copy_batch::add(const data::vector_view<TYPE1>& from,
+                            data::vector_view<TYPE2> to) {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(std::is_same<TYPE1, TYPE2>::value ||
+                      details::is_same_nc<TYPE1, TYPE2>::value,
+                  "Can only use compatible types in the copy");
+
+    // Get the size of the source view.
+    const size_type size = m_copy.stored_size(from);
+
+    // Make sure that the copy can happen.
+    if (to.capacity() < size) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to.capacity() << ") < source size ("
+            << size << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Set the size of the target, if it is resizable.
+    if (to.size_ptr() != nullptr) {
+        m_sizes.emplace_back(1, size);
+        add(sizeof(size_type), m_sizes.back().data(), to.size_ptr());
+    }
+
+    // Add the payload.
+    return add(size * sizeof(TYPE1), from.ptr(), to.ptr());
+}
+
+template <typename TYPE1, typename TYPE2>
+copy_batch& copy_batch::add(const data::jagged_vector_view<TYPE1>& from,
+                            data::jagged_vector_view<TYPE2> to) {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(std::is_same<TYPE1, TYPE2>::value ||
+                      details::is_same_nc<TYPE1, TYPE2>::value,
+                  "Can only use compatible types in the copy");
+
+    // A sanity check.
+    if (from.size() > to.size()) {
+        std::ostringstream msg;
+        msg << "from.size() (" << from.size() << ") > to.size() ("
+            << to.size() << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Check if anything needs to be done.
+    if (from.size() == 0) {
+        return *this;
+    }
+
+    // Get the sizes of the source jagged vector.
+    std::vector<size_type> sizes = m_copy.get_sizes(from);
+    copy::clamp_sizes(sizes, from.host_ptr());
+
+    // Make sure that the copy can happen, before adding anything to the
+    // batch.
+    const bool resizable = copy::needs_size_update(sizes, to);
+
+    // Add the copies of the "inner vectors".
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        add(sizes[i] * sizeof(TYPE1), from.host_ptr()[i].ptr(),
+            to.host_ptr()[i].ptr());
+    }
+
+    // Set the sizes of the target, if it is resizable.
+    if (resizable) {
+        m_sizes.push_back(std::move(sizes));
+        add(sizeof(size_type) * m_sizes.back().size(), m_sizes.back().data(),
+            to.host_ptr()->size_ptr());
+    }
+
+    // Return this object.
+    return *this;
+}
+
+}  // namespace vecmem
@@ -0,0 +1,233 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/type_traits.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vecmem {
+
+template <typename TYPE1, typename TYPE2>
+copy_plan::binding_pair copy_plan::add(const data::vector_view<TYPE1>& from,
+                                       data::vector_view<TYPE2> to) {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(std::is_same<TYPE1, TYPE2>::value ||
+                      details::is_same_nc<TYPE1, TYPE2>::value,
+                  "Can only use compatible types in the copy");
+
+    // Make sure that the copy can happen.
+    if (to.capacity() < from.capacity()) {
+        std::ostringstream msg;
+        msg << "Target capacity (" << to.capacity()
+            << ") < source capacity (" << from.capacity() << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Create the bindings for the two views.
+    const binding_pair result = {add_binding(base_of(from)),
+                                 add_binding(base_of(to))};
+
+    // Take care of the size of the target.
+    if (from.size_ptr() != nullptr) {
+        // Resizable sources need to have their sizes copied.
+        if (to.size_ptr() == nullptr) {
+            throw std::invalid_argument(
+                "Resizable source views can only be recorded with resizable "
+                "targets");
+        }
+        if (to.capacity() == from.capacity()) {
+            add_copy(sizeof(size_type), result.from, from.size_ptr(),
+                     result.to, to.size_ptr());
+        } else {
+            // The size of an overflowed source could be "valid" for the
+            // larger target, so it needs to be limited during the replay.
+            add_size_copy({from.capacity()}, result.from, from.size_ptr(),
+                          result.to, to.size_ptr());
+        }
+    } else if (to.size_ptr() != nullptr) {
+        // Resizable targets of fixed sized sources get their size from the
+        // plan.
+        m_sizes.emplace_back(1, from.capacity());
+        const binding_id sizes_id = add_binding(
+            reinterpret_cast<std::uintptr_t>(m_sizes.back().data()));
+        add_copy(sizeof(size_type), sizes_id, m_sizes.back().data(), result.to,
+                 to.size_ptr());
+    }
+
+    // Add the payload.
+    add_copy(from.capacity() * sizeof(TYPE1), result.from, from.ptr(),
+             result.to, to.ptr());
+
+    // Return the bindings.
+    return result;
+}
+
+template <typename TYPE1, typename TYPE2>
+copy_plan::binding_pair copy_plan::add(
+    const data::jagged_vector_view<TYPE1>& from,
+    data::jagged_vector_view<TYPE2> to) {
+
+    // The input and output types are allowed to be different, but only by
+    // const-ness.
+    static_assert(std::is_same<TYPE1, TYPE2>::value ||
+                      details::is_same_nc<TYPE1, TYPE2>::value,
+                  "Can only use compatible types in the copy");
+
+    // A sanity check.
+    if (from.size() > to.size()) {
+        std::ostringstream msg;
+        msg << "from.size() (" << from.size() << ") > to.size() ("
+            << to.size() << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Create the bindings for the two views.
+    const binding_pair result = {add_binding(base_of(from)),
+                                 add_binding(base_of(to))};
+
+    // Add the copies of the "inner vectors", using their full capacities.
+    const std::size_t size = from.size();
+    std::size_t first_resizable = size;
+    for (std::size_t i = 0; i < size; ++i) {
+        const data::vector_view<TYPE1>& from_inner = from.host_ptr()[i];
+        const data::vector_view<TYPE2>& to_inner = to.host_ptr()[i];
+        if (to_inner.capacity() < from_inner.capacity()) {
+            std::ostringstream msg;
+            msg << "Target capacity (" << to_inner.capacity()
+                << ") < source capacity (" << from_inner.capacity()
+                << ") for inner vector " << i;
+            throw std::length_error(msg.str());
+        }
+        if ((first_resizable == size) && (from_inner.capacity() != 0) &&
+            (from_inner.size_ptr() != nullptr)) {
+            first_resizable = i;
+        }
+        add_copy(from_inner.capacity() * sizeof(TYPE1), result.from,
+                 from_inner.ptr(), result.to, to_inner.ptr());
+    }
+
+    // Take care of the sizes of the target.
+    if (first_resizable < size) {
+        // The sizes of resizable sources need to be copied.
+        if (to.host_ptr()[first_resizable].size_ptr() == nullptr) {
+            throw std::invalid_argument(
+                "Resizable source views can only be recorded with resizable "
+                "targets");
+        }
+        std::vector<size_type> capacities(size - first_resizable);
+        bool same_capacities = true;
+        for (std::size_t i = first_resizable; i < size; ++i) {
+            capacities[i - first_resizable] = from.host_ptr()[i].capacity();
+            same_capacities &= (to.host_ptr()[i].capacity() ==
+                                from.host_ptr()[i].capacity());
+        }
+        if (same_capacities) {
+            add_copy(sizeof(size_type) * capacities.size(), result.from,
+                     from.host_ptr()[first_resizable].size_ptr(), result.to,
+                     to.host_ptr()[first_resizable].size_ptr());
+        } else {
+            // The sizes of overflowed sources could be "valid" for the larger
+            // targets, so they need to be limited during the replay.
+            add_size_copy(std::move(capacities), result.from,
+                          from.host_ptr()[first_resizable].size_ptr(),
+                          result.to, to.host_ptr()[first_resizable].size_ptr());
+        }
+    } else if (size != 0) {
+        // Resizable targets of fixed sized sources get their sizes from the
+        // plan.
+        std::vector<size_type> sizes(size);
+        std::transform(from.host_ptr(), from.host_ptr() + size, sizes.begin(),
+                       [](const data::vector_view<TYPE1>& inner) {
+                           return inner.capacity();
+                       });
+        if (copy::needs_size_update(sizes, to)) {
+            m_sizes.push_back(std::move(sizes));
+            const binding_id sizes_id = add_binding(
+                reinterpret_cast<std::uintptr_t>(m_sizes.back().data()));
+            add_copy(sizeof(size_type) * size, sizes_id, m_sizes.back().data(),
+                     result.to, to.host_ptr()->size_ptr());
+        }
+    }
+
+    // Return the bindings.
+    return result;
+}
+
+template <typename TYPE>
+copy_plan::binding_id copy_plan::memset(data::vector_view<TYPE> data,
+                                        int value) {
+
+    // Create the binding for the view.
+    const binding_id result = add_binding(base_of(data));
+
+    // Record the operation.
+    if (data.capacity() != 0) {
+        m_fills.push_back({data.capacity() * sizeof(TYPE),
+                           make_endpoint(result, data.ptr()), value});
+        m_resolved = false;
+    }
+
+    // Return the binding.
+    return result;
+}
+
+template <typename TYPE>
+void copy_plan::rebind(binding_id id, const data::vector_view<TYPE>& data) {
+
+    set_binding(id, base_of(data));
+}
+
+template <typename TYPE>
+void copy_plan::rebind(binding_id id,
+                       const data::jagged_vector_view<TYPE>& data) {
+
+    set_binding(id, base_of(data));
+}
+
+template <typename TYPE>
+std::uintptr_t copy_plan::base_of(const data::vector_view<TYPE>& data) {
+
+    // Find the lowest address used by the view.
+    std::uintptr_t result = 0;
+    if (data.capacity() != 0) {
+        result = reinterpret_cast<std::uintptr_t>(data.ptr());
+    }
+    if (data.size_ptr() != nullptr) {
+        const std::uintptr_t size_ptr =
+            reinterpret_cast<std::uintptr_t>(data.size_ptr());
+        result = ((result == 0) ? size_ptr : std::min(result, size_ptr));
+    }
+    return result;
+}
+
+template <typename TYPE>
+std::uintptr_t copy_plan::base_of(
+    const data::jagged_vector_view<TYPE>& data) {
+
+    // Find the lowest address used by any of the inner vectors.
+    std::uintptr_t result = 0;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        const std::uintptr_t inner = base_of(data.host_ptr()[i]);
+        if (inner != 0) {
+            result = ((result == 0) ? inner : std::min(result, inner));
+        }
+    }
+    return result;
+}
+
+}  // namespace vecmem
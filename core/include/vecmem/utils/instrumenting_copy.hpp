@@ -0,0 +1,253 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+/// Copy object forwarding its operations to another one, while recording
+/// statistics about them
+///
+/// It does for copies what @c vecmem::instrumenting_memory_resource does for
+/// memory allocations. All "low level" operations (the ones that backends
+/// implement) are counted, and their sizes and latencies are collected into
+/// histograms, separately for every copy type and "tag". Tags can be used to
+/// attribute the operations to different parts of the client code. They are
+/// set separately for every thread using the object.
+///
+/// The staging and compression settings of the upstream copy object are
+/// taken over by this object, since the high level copy logic is executed
+/// by it.
+///
+/// Note that for asynchronous upstream copy objects the latencies describe
+/// how long it took to issue the operations, not how long it took to
+/// execute them.
+///
+class VECMEM_CORE_EXPORT instrumenting_copy : public copy {
+
+public:
+    /// Histogram with logarithmic (power of 2) bins
+    ///
+    /// Bin 0 counts zero values, bin @c i counts values in the range
+    /// [2^(i-1), 2^i). The last bin also counts all larger values.
+    ///
+    struct VECMEM_CORE_EXPORT histogram {
+        /// The number of bins in the histogram
+        static constexpr std::size_t n_bins = 48;
+        /// Get the bin that a value belongs to
+        static std::size_t bin(std::uint64_t value);
+        /// Add a value to the histogram
+        void fill(std::uint64_t value);
+        /// Add the contents of another histogram to this one
+        histogram& operator+=(const histogram& other);
+        /// The contents of the bins
+        std::array<std::size_t, n_bins> counts = {};
+    };  // struct histogram
+
+    /// Statistics of one type of operations
+    struct VECMEM_CORE_EXPORT statistics {
+        /// The number of calls made to the upstream copy object
+        std::size_t calls = 0;
+        /// The number of individual copies (memory blocks) in those calls
+        std::size_t copies = 0;
+        /// The total number of bytes processed
+        std::size_t bytes = 0;
+        /// The total time spent in the calls (in nanoseconds)
+        std::uint64_t time = 0;
+        /// Histogram of the sizes of the individual copies (in bytes)
+        histogram sizes;
+        /// Histogram of the latencies of the calls (in nanoseconds)
+        histogram latencies;
+        /// Add the contents of another object to this one
+        statistics& operator+=(const statistics& other);
+    };  // struct statistics
+
+    /// Helper object setting the tag of an instrumenting copy object for the
+    /// calling thread, for its own lifetime
+    class VECMEM_CORE_EXPORT scoped_tag {
+    public:
+        /// Constructor with the copy object and the tag to use
+        scoped_tag(instrumenting_copy& copy, const std::string& tag);
+        /// Destructor, restoring the previous tag
+        ~scoped_tag();
+        /// Disallow copying the object
+        scoped_tag(const scoped_tag&) = delete;
+        /// Disallow copying the object
+        scoped_tag& operator=(const scoped_tag&) = delete;
+
+    private:
+        /// The copy object whose tag was set
+        instrumenting_copy& m_copy;
+        /// The tag used before this object was created
+        std::string m_previous;
+    };  // class scoped_tag
+
+    /// Function type for the hooks called before every copy
+    ///
+    /// The arguments are the number of bytes, the source and target of the
+    /// copy, and the type of the copy.
+    ///
+    typedef std::function<void(std::size_t, const void*, void*,
+                               type::copy_type)>
+        pre_copy_hook;
+    /// Function type for the hooks called after every copy
+    ///
+    /// The extra last argument is the time that the copy took (in
+    /// nanoseconds).
+    ///
+    typedef std::function<void(std::size_t, const void*, void*,
+                               type::copy_type, std::uint64_t)>
+        post_copy_hook;
+    /// Function type for the hooks called after every batch of copies
+    ///
+    /// The arguments are the copies of the batch, their type, and the time
+    /// that the entire batch took (in nanoseconds).
+    ///
+    typedef std::function<void(const std::vector<segment>&, type::copy_type,
+                               std::uint64_t)>
+        post_copy_batch_hook;
+
+    /// Constructor with the copy object to forward the operations to
+    instrumenting_copy(const copy& upstream);
+    /// Destructor
+    ~instrumenting_copy();
+
+    /// @name Tag handling
+    /// @{
+
+    /// Set the tag to attribute the following operations of the calling
+    /// thread to
+    void set_tag(const std::string& tag);
+    /// Get the tag that the operations of the calling thread are currently
+    /// attributed to
+    std::string get_tag() const;
+    /// Get all the tags that operations were recorded for
+    std::vector<std::string> get_tags() const;
+
+    /// @}
+
+    /// @name Statistics access
+    /// @{
+
+    /// Get the statistics of all copies of a given type
+    statistics get_statistics(type::copy_type cptype) const;
+    /// Get the statistics of the copies of a given type, and with a given tag
+    statistics get_statistics(const std::string& tag,
+                              type::copy_type cptype) const;
+    /// Get the statistics of all memory filling operations
+    statistics get_memset_statistics() const;
+    /// Get the statistics of the memory filling operations with a given tag
+    statistics get_memset_statistics(const std::string& tag) const;
+
+    /// Forget about all previously recorded operations
+    void reset();
+
+    /// @}
+
+    /// @name Hooks
+    /// @{
+
+    /// Add a function to call before every individual copy
+    ///
+    /// It is called for each copy of a batch as well.
+    ///
+    void add_pre_copy_hook(pre_copy_hook f);
+    /// Add a function to call after every individual copy
+    ///
+    /// Batches of copies are not reported to it, since the individual
+    /// copies of a batch are not timed. See @c add_post_copy_batch_hook.
+    ///
+    void add_post_copy_hook(post_copy_hook f);
+    /// Add a function to call (once) after every batch of copies
+    void add_post_copy_batch_hook(post_copy_batch_hook f);
+
+    /// @}
+
+protected:
+    /// Forward a memory copy to the upstream object
+    virtual void do_copy(std::size_t size, const void* from, void* to,
+                         type::copy_type cptype) const override;
+    /// Forward a batch of memory copies to the upstream object
+    virtual void do_copy_batch(const std::vector<segment>& segments,
+                               type::copy_type cptype) const override;
+    /// Forward a memory copy from a temporary buffer to the upstream object
+    virtual void do_copy_temporary(std::size_t size, const void* from,
+                                   void* to,
+                                   type::copy_type cptype) const override;
+    /// Forward a memory filling operation to the upstream object
+    virtual void do_memset(std::size_t size, void* ptr,
+                           int value) const override;
+    /// Create an event using the upstream object
+    virtual event_type create_event() const override;
+
+private:
+    /// The statistics recorded for one tag
+    struct tag_statistics {
+        /// Statistics of the copies, per copy type
+        std::array<statistics, type::count> copies;
+        /// Statistics of the memory filling operations
+        statistics memsets;
+    };  // struct tag_statistics
+
+    /// Forward a memory copy to the upstream object, and record it
+    void record_copy(std::size_t size, const void* from, void* to,
+                     type::copy_type cptype, bool temporary) const;
+
+    /// Get the statistics of the calling thread's current tag
+    ///
+    /// It has to be called with @c m_mutex locked.
+    ///
+    tag_statistics& current() const;
+
+    /// The copy object that the operations are forwarded to
+    const copy& m_upstream;
+    /// The tags to attribute the operations to, for the different threads
+    ///
+    /// Threads using the default (empty) tag have no entry in the map.
+    ///
+    std::map<std::thread::id, std::string> m_tags;
+    /// The statistics recorded for the different tags
+    mutable std::map<std::string, tag_statistics> m_statistics;
+    /// The hooks called before every copy
+    std::vector<pre_copy_hook> m_pre_copy_hooks;
+    /// The hooks called after every copy
+    std::vector<post_copy_hook> m_post_copy_hooks;
+    /// The hooks called after every batch of copies
+    std::vector<post_copy_batch_hook> m_post_copy_batch_hooks;
+    /// Mutex protecting the statistics
+    mutable std::mutex m_mutex;
+
+};  // class instrumenting_copy
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
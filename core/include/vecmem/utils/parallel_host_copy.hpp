@@ -0,0 +1,112 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+/// Host memory copy engine spreading large copies over multiple threads
+///
+/// A single thread can usually only make use of a fraction of the memory
+/// bandwidth of a multi-core machine. This class splits up copies and memory
+/// filling operations above a configurable size into contiguous chunks, which
+/// are processed in parallel by the threads of a @c vecmem::thread_pool.
+///
+/// Every thread works on one contiguous block of the source and target
+/// memory. So when the target memory is touched first by such a copy, the
+/// usual "first touch" page placement policy of the operating system puts
+/// the pages of each chunk onto the NUMA node of the thread processing it.
+///
+/// The class can only be used with host-accessible memory.
+///
+class VECMEM_CORE_EXPORT parallel_host_copy : public copy {
+
+public:
+    /// Configuration for the copy engine
+    struct config {
+        /// Operations smaller than this (in bytes) run on the calling thread
+        std::size_t parallel_threshold = 4 * 1024 * 1024;
+        /// The smallest amount of data (in bytes) handed to a single thread
+        std::size_t min_chunk_size = 1024 * 1024;
+        /// Operations at least this large (in bytes) use non-temporal stores
+        ///
+        /// Such stores bypass the caches, which is beneficial when writing
+        /// large amounts of data that will not be read again soon. (Like
+        /// staging buffers for device transfers.) They are only available on
+        /// x86 CPUs, the option has no effect on other platforms. By default
+        /// they are not used.
+        ///
+        std::size_t non_temporal_threshold =
+            std::numeric_limits<std::size_t>::max();
+    };  // struct config
+
+    /// Constructor with the number of threads to use
+    ///
+    /// @param n_threads The number of worker threads to start in a private
+    ///        thread pool. With 0, the number of hardware threads is used.
+    ///
+    parallel_host_copy(std::size_t n_threads = 0);
+    /// Constructor with the number of threads, and a custom configuration
+    parallel_host_copy(std::size_t n_threads, const config& cfg);
+    /// Constructor with an externally owned thread pool
+    parallel_host_copy(thread_pool& pool);
+    /// Constructor with an externally owned thread pool, and a configuration
+    parallel_host_copy(thread_pool& pool, const config& cfg);
+    /// Destructor
+    ~parallel_host_copy();
+
+    /// Get the configuration of the object
+    const config& get_config() const;
+
+protected:
+    /// Perform a (possibly multi-threaded) memory copy
+    virtual void do_copy(std::size_t size, const void* from, void* to,
+                         type::copy_type cptype) const override;
+    /// Perform a batch of memory copies, spread over multiple threads
+    virtual void do_copy_batch(const std::vector<segment>& segments,
+                               type::copy_type cptype) const override;
+    /// Perform a (possibly multi-threaded) memory filling operation
+    virtual void do_memset(std::size_t size, void* ptr,
+                           int value) const override;
+
+private:
+    /// Get the number of chunks to split an operation of a given size into
+    std::size_t n_chunks(std::size_t size) const;
+
+    /// Thread pool owned by this object (if any)
+    std::unique_ptr<thread_pool> m_owned_pool;
+    /// The thread pool used by the object
+    thread_pool& m_pool;
+    /// The configuration of the object
+    config m_config;
+
+};  // class parallel_host_copy
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
@@ -0,0 +1,66 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/utils/codec.hpp"
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+/// Fast, general purpose codec using a byte shuffle and LZ77 compression
+///
+/// The bytes of the elements in every chunk are first re-ordered, such that
+/// the first bytes of all elements come first, then their second bytes, etc.
+/// This groups the (usually similar) high bytes of numeric data together.
+/// The result is then compressed using a simple, byte oriented LZ77 scheme,
+/// in the spirit of LZ4.
+///
+class VECMEM_CORE_EXPORT shuffle_lz_codec : public codec {
+
+public:
+    /// Constructor with the element size and chunk size to use
+    ///
+    /// @param element_size The size of the elements to shuffle the bytes of.
+    ///        With 1 no shuffling is done.
+    /// @param chunk_size The size of the independently compressed chunks,
+    ///        which is rounded down to a multiple of @c element_size
+    ///
+    shuffle_lz_codec(std::size_t element_size = 1,
+                     std::size_t chunk_size = default_chunk_size);
+
+    /// Get the size of the elements that the bytes are shuffled of
+    std::size_t element_size() const;
+
+protected:
+    /// @name Function(s) implementing @c vecmem::codec
+    /// @{
+
+    /// Get the maximal compressed size of a single chunk
+    virtual std::size_t do_max_compressed_size(
+        std::size_t size) const override;
+    /// Compress a single chunk
+    virtual std::size_t do_compress(const void* in, std::size_t size,
+                                    void* out,
+                                    std::size_t capacity) const override;
+    /// Decompress a single chunk
+    virtual void do_decompress(const void* in, std::size_t compressed_size,
+                               void* out, std::size_t size) const override;
+
+    /// @}
+
+private:
+    /// The size of the elements that the bytes are shuffled of
+    std::size_t m_element_size;
+
+};  // class shuffle_lz_codec
+
+}  // namespace vecmem
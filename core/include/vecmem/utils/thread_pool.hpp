@@ -0,0 +1,82 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+// Forward declaration(s).
+namespace details {
+struct thread_pool_impl;
+}
+
+/// Simple, persistent pool of worker threads
+///
+/// It is used by the host side utilities of the project that need to spread
+/// their work over multiple threads. The worker threads are started in the
+/// constructor, and are joined in the destructor of the object.
+///
+class VECMEM_CORE_EXPORT thread_pool {
+
+public:
+    /// Constructor with the number of worker threads to use
+    ///
+    /// @param n_threads The number of worker threads to start. With the
+    ///        default value of 0, the number of hardware threads is used.
+    ///
+    thread_pool(std::size_t n_threads = 0);
+    /// Destructor, waiting for all tasks to finish
+    ~thread_pool();
+
+    /// Disallow copying the object
+    thread_pool(const thread_pool&) = delete;
+    /// Disallow copying the object
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// Get the number of worker threads
+    std::size_t size() const;
+
+    /// Schedule a task for asynchronous execution on one of the workers
+    void submit(std::function<void()> task);
+
+    /// Execute a function for all indices in [0, n_tasks) in parallel
+    ///
+    /// The calling thread takes part in the processing, so the function can
+    /// also be used from tasks that are running on the pool itself. It only
+    /// returns once all of the indices were processed. The first exception
+    /// thrown by @c func is re-thrown to the caller.
+    ///
+    void parallel_for(std::size_t n_tasks,
+                      const std::function<void(std::size_t)>& func);
+
+private:
+    /// Object implementing the pool's logic
+    std::unique_ptr<details::thread_pool_impl> m_impl;
+
+};  // class thread_pool
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
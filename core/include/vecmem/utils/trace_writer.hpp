@@ -0,0 +1,180 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// VecMem include(s).
+#include "vecmem/vecmem_core_export.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
+namespace vecmem {
+
+// Forward declaration(s).
+class instrumenting_copy;
+class instrumenting_memory_resource;
+
+/// Writer of Chrome trace event (JSON) files
+///
+/// It collects memory allocations, memory copies and arbitrary user defined
+/// time slices, and writes them in the "trace event" JSON format understood
+/// by Chrome's @c about://tracing and by the Perfetto UI. Allowing these
+/// operations to be inspected on a timeline.
+///
+/// The events are collected into an in-memory buffer first, which is only
+/// formatted and written out once it fills up, when @c flush is called, or
+/// when the object is destroyed.
+///
+/// All names and categories given to the object must be strings with a
+/// static storage duration. (Simple string literals.) They are escaped as
+/// necessary when written to the JSON output.
+///
+/// The object is thread safe. It must outlive all objects that it is
+/// attached to.
+///
+class VECMEM_CORE_EXPORT trace_writer {
+
+public:
+    /// Type of the timestamps and durations (in nanoseconds)
+    typedef std::uint64_t time_type;
+
+    /// Helper object recording a time slice, for its own lifetime
+    class VECMEM_CORE_EXPORT scoped_event {
+    public:
+        /// Constructor with the writer, and the name/category of the slice
+        scoped_event(trace_writer& writer, const char* name,
+                     const char* category = "user");
+        /// Destructor, recording the time slice
+        ~scoped_event();
+        /// Disallow copying the object
+        scoped_event(const scoped_event&) = delete;
+        /// Disallow copying the object
+        scoped_event& operator=(const scoped_event&) = delete;
+
+    private:
+        /// The writer to record the time slice with
+        trace_writer& m_writer;
+        /// The name of the time slice
+        const char* m_name;
+        /// The category of the time slice
+        const char* m_category;
+        /// The start of the time slice
+        time_type m_start;
+    };  // class scoped_event
+
+    /// Constructor writing to a file
+    ///
+    /// @param filename The name of the file to write
+    /// @param buffer_size The number of events to collect before writing
+    ///
+    trace_writer(const std::string& filename, std::size_t buffer_size = 4096);
+    /// Constructor writing to an existing stream
+    ///
+    /// @param stream The stream to write to
+    /// @param buffer_size The number of events to collect before writing
+    ///
+    trace_writer(std::ostream& stream, std::size_t buffer_size = 4096);
+    /// Destructor, writing all remaining events and closing the output
+    ~trace_writer();
+
+    /// Disallow copying the object
+    trace_writer(const trace_writer&) = delete;
+    /// Disallow copying the object
+    trace_writer& operator=(const trace_writer&) = delete;
+
+    /// Get the current time (in nanoseconds, relative to the writer's start)
+    time_type now() const;
+
+    /// Record a time slice
+    ///
+    /// @param name The name of the slice
+    /// @param category The category of the slice
+    /// @param start The start time of the slice (see @c now)
+    /// @param duration The duration of the slice (in nanoseconds)
+    /// @param bytes The number of bytes processed in the slice (optional)
+    ///
+    void complete(const char* name, const char* category, time_type start,
+                  time_type duration, std::size_t bytes = 0);
+    /// Record an instantaneous event
+    void instant(const char* name, const char* category,
+                 std::size_t bytes = 0);
+
+    /// Record the allocations/de-allocations of a memory resource
+    void attach(instrumenting_memory_resource& resource);
+    /// Record the (low level) operations of a copy object
+    ///
+    /// Batches of copies are recorded as single events.
+    ///
+    void attach(instrumenting_copy& copy);
+
+    /// Write all collected events to the output
+    void flush();
+
+private:
+    /// Description of a single event
+    struct record {
+        /// The name of the event
+        const char* name;
+        /// The category of the event
+        const char* category;
+        /// The type ("phase") of the event
+        char phase;
+        /// The (small) identifier of the thread recording the event
+        unsigned int thread;
+        /// The start time of the event
+        time_type start;
+        /// The duration of the event
+        time_type duration;
+        /// The number of bytes associated with the event
+        std::size_t bytes;
+    };  // struct record
+
+    /// Add a record to the buffer, flushing it if necessary
+    void add(const record& r);
+    /// Write the buffered records to the output
+    ///
+    /// It has to be called with @c m_mutex locked.
+    ///
+    void write_records();
+
+    /// File stream owned by the writer (if any)
+    std::ofstream m_file;
+    /// The stream that the events are written to
+    std::ostream& m_stream;
+    /// The number of records to collect before writing them out
+    std::size_t m_buffer_size;
+    /// The buffered records
+    std::vector<record> m_records;
+    /// Flag showing whether any record was written out yet
+    bool m_first = true;
+    /// The start time of the writer (in nanoseconds since the clock's epoch)
+    time_type m_start;
+    /// Mutex protecting the buffer and the output
+    std::mutex m_mutex;
+
+};  // class trace_writer
+
+}  // namespace vecmem
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
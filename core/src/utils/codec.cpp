@@ -0,0 +1,218 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/codec.hpp"
+
+#include "vecmem/utils/debug.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Identifier written at the beginning of every frame
+constexpr std::uint32_t frame_magic = 0x31434d56;  // "VMC1"
+
+/// Header written at the beginning of every frame
+///
+/// It is followed by the compressed sizes of all chunks, as 64-bit integers,
+/// and then by the compressed chunks themselves.
+///
+struct frame_header {
+    /// Identifier of the frame format
+    std::uint32_t magic;
+    /// The number of chunks in the frame
+    std::uint32_t n_chunks;
+    /// The (decompressed) size of the chunks
+    std::uint64_t chunk_size;
+    /// The decompressed size of the frame
+    std::uint64_t size;
+};  // struct frame_header
+
+/// Get the size of the frame header with the chunk sizes
+std::size_t header_size(std::size_t n_chunks) {
+
+    return sizeof(frame_header) + n_chunks * sizeof(std::uint64_t);
+}
+
+/// Read and validate the header of a frame
+frame_header read_header(const void* in, std::size_t frame_size) {
+
+    frame_header header;
+    if (frame_size < sizeof(header)) {
+        throw std::runtime_error("Truncated compression frame");
+    }
+    std::memcpy(&header, in, sizeof(header));
+    if (header.magic != frame_magic) {
+        throw std::runtime_error("Invalid compression frame");
+    }
+    if ((header.chunk_size == 0) ||
+        (header.n_chunks !=
+         (header.size + header.chunk_size - 1) / header.chunk_size) ||
+        (frame_size < header_size(header.n_chunks))) {
+        throw std::runtime_error("Corrupt compression frame header");
+    }
+    return header;
+}
+
+/// Execute a function for every chunk, possibly in parallel
+void for_each_chunk(std::size_t n_chunks, vecmem::thread_pool* pool,
+                    const std::function<void(std::size_t)>& func) {
+
+    if ((pool == nullptr) || (n_chunks < 2)) {
+        for (std::size_t i = 0; i < n_chunks; ++i) {
+            func(i);
+        }
+    } else {
+        pool->parallel_for(n_chunks, func);
+    }
+}
+
+}  // namespace
+
+namespace vecmem {
+
+codec::codec(std::size_t chunk_size) : m_chunk_size(chunk_size) {
+
+    if (m_chunk_size == 0) {
+        throw std::invalid_argument("The chunk size must not be zero");
+    }
+}
+
+codec::~codec() {}
+
+std::size_t codec::chunk_size() const {
+
+    return m_chunk_size;
+}
+
+std::size_t codec::max_compressed_size(std::size_t size) const {
+
+    const std::size_t n_chunks = (size + m_chunk_size - 1) / m_chunk_size;
+    return header_size(n_chunks) +
+           n_chunks *
+               std::max(do_max_compressed_size(m_chunk_size), m_chunk_size);
+}
+
+std::size_t codec::compress(const void* in, std::size_t size, void* out,
+                            std::size_t capacity, thread_pool* pool) const {
+
+    // Make sure that the compression can happen.
+    if (capacity < max_compressed_size(size)) {
+        std::ostringstream msg;
+        msg << "Output capacity (" << capacity
+            << ") < maximal compressed size (" << max_compressed_size(size)
+            << ")";
+        throw std::length_error(msg.str());
+    }
+
+    // Helper variables.
+    const std::size_t n_chunks = (size + m_chunk_size - 1) / m_chunk_size;
+    const std::size_t bound =
+        std::max(do_max_compressed_size(m_chunk_size), m_chunk_size);
+    const char* input = static_cast<const char*>(in);
+    char* data = static_cast<char*>(out) + header_size(n_chunks);
+    std::vector<std::uint64_t> sizes(n_chunks);
+
+    // Compress the chunks into their own slots of the output.
+    for_each_chunk(n_chunks, pool, [&](std::size_t i) {
+        const std::size_t begin = i * m_chunk_size;
+        const std::size_t length = std::min(m_chunk_size, size - begin);
+        char* chunk = data + i * bound;
+        std::size_t compressed =
+            do_compress(input + begin, length, chunk, bound);
+        // Store the chunk as-is if it could not be compressed.
+        if ((compressed == 0) || (compressed >= length)) {
+            std::memcpy(chunk, input + begin, length);
+            compressed = length;
+        }
+        sizes[i] = compressed;
+    });
+
+    // Move the compressed chunks next to each other.
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        std::memmove(data + offset, data + i * bound, sizes[i]);
+        offset += sizes[i];
+    }
+
+    // Write the header.
+    const frame_header header = {frame_magic,
+                                 static_cast<std::uint32_t>(n_chunks),
+                                 m_chunk_size, size};
+    std::memcpy(out, &header, sizeof(header));
+    if (n_chunks != 0) {
+        std::memcpy(static_cast<char*>(out) + sizeof(header), sizes.data(),
+                    n_chunks * sizeof(std::uint64_t));
+    }
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(3, "Compressed %lu bytes into %lu bytes in %lu chunk(s)",
+                     size, header_size(n_chunks) + offset, n_chunks);
+    return header_size(n_chunks) + offset;
+}
+
+void codec::decompress(const void* in, std::size_t frame_size, void* out,
+                       std::size_t size, thread_pool* pool) const {
+
+    // Read the header of the frame.
+    const frame_header header = read_header(in, frame_size);
+    if (header.size != size) {
+        std::ostringstream msg;
+        msg << "Frame size (" << header.size << ") != output size (" << size
+            << ")";
+        throw std::length_error(msg.str());
+    }
+    std::vector<std::uint64_t> sizes(header.n_chunks);
+    if (header.n_chunks != 0) {
+        std::memcpy(sizes.data(),
+                    static_cast<const char*>(in) + sizeof(header),
+                    header.n_chunks * sizeof(std::uint64_t));
+    }
+
+    // Find where the individual chunks start.
+    std::vector<std::size_t> offsets(header.n_chunks);
+    std::size_t offset = header_size(header.n_chunks);
+    for (std::size_t i = 0; i < header.n_chunks; ++i) {
+        offsets[i] = offset;
+        offset += sizes[i];
+        if ((sizes[i] > frame_size) || (offset > frame_size)) {
+            throw std::runtime_error("Truncated compression frame");
+        }
+    }
+
+    // Decompress the chunks.
+    const char* input = static_cast<const char*>(in);
+    char* output = static_cast<char*>(out);
+    const std::size_t chunk = static_cast<std::size_t>(header.chunk_size);
+    for_each_chunk(header.n_chunks, pool, [&](std::size_t i) {
+        const std::size_t begin = i * chunk;
+        const std::size_t length = std::min(chunk, size - begin);
+        if (sizes[i] == length) {
+            std::memcpy(output + begin, input + offsets[i], length);
+        } else {
+            do_decompress(input + offsets[i], sizes[i], output + begin,
+                          length);
+        }
+    });
+}
+
+std::size_t codec::decompressed_size(const void* in, std::size_t frame_size) {
+
+    return static_cast<std::size_t>(read_header(in, frame_size).size);
+}
+
+}  // namespace vecmem
@@ -9,16 +9,122 @@
 // VecMem include(s).
 #include "vecmem/utils/copy.hpp"
 
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/unique_ptr.hpp"
+#include "vecmem/utils/codec.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+#include "vecmem/utils/copy_plan.hpp"
 #include "vecmem/utils/debug.hpp"
+#include "vecmem/utils/thread_pool.hpp"
 
 // System include(s).
+#include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace {
 /// Empty/no-op implementation for @c vecmem::abstract_event
 struct noop_event : public vecmem::abstract_event {
     virtual void wait() override {}
+    virtual bool is_ready() override { return true; }
 };  // struct noop_event
+
+/// Run a two-stage pipeline over a number of chunks
+///
+/// The producer stage fills (one of @c n_buffers rotating) buffers for the
+/// chunks, which the consumer stage drains. The host stage runs on a helper
+/// thread, the device stage on the calling thread.
+///
+/// @param host_produces @c true if the host stage is the producer
+///
+void run_pipeline(std::size_t n_chunks, std::size_t n_buffers,
+                  bool host_produces,
+                  const std::function<void(std::size_t)>& host_stage,
+                  const std::function<void(std::size_t)>& device_stage) {
+
+    // The state shared by the two stages.
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t produced = 0, consumed = 0;
+    bool abort = false;
+
+    // The loops of the two stages.
+    auto producer = [&](const std::function<void(std::size_t)>& stage) {
+        for (std::size_t i = 0; i < n_chunks; ++i) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() {
+                    return abort || (i < consumed + n_buffers);
+                });
+                if (abort) {
+                    return;
+                }
+            }
+            stage(i);
+            std::lock_guard<std::mutex> lock(mutex);
+            produced = i + 1;
+            cv.notify_all();
+        }
+    };
+    auto consumer = [&](const std::function<void(std::size_t)>& stage) {
+        for (std::size_t i = 0; i < n_chunks; ++i) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return abort || (i < produced); });
+                if (abort) {
+                    return;
+                }
+            }
+            stage(i);
+            std::lock_guard<std::mutex> lock(mutex);
+            consumed = i + 1;
+            cv.notify_all();
+        }
+    };
+    // Helper stopping the pipeline after a failure.
+    auto stop = [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        abort = true;
+        cv.notify_all();
+    };
+
+    // Start the host stage on a helper thread.
+    std::exception_ptr host_error;
+    std::thread helper([&]() {
+        try {
+            if (host_produces) {
+                producer(host_stage);
+            } else {
+                consumer(host_stage);
+            }
+        } catch (...) {
+            host_error = std::current_exception();
+            stop();
+        }
+    });
+
+    // Run the device stage on this thread.
+    try {
+        if (host_produces) {
+            consumer(device_stage);
+        } else {
+            producer(device_stage);
+        }
+    } catch (...) {
+        stop();
+        helper.join();
+        throw;
+    }
+    helper.join();
+    if (host_error) {
+        std::rethrow_exception(host_error);
+    }
+}
+
 }  // namespace
 
 namespace vecmem {
@@ -46,10 +152,412 @@ void copy::do_memset(std::size_t size, void* ptr, int value) const {
                      value, ptr);
 }
 
+void copy::do_copy_batch(const std::vector<segment>& segments,
+                         type::copy_type cptype) const {
+
+    // Perform the copies one by one.
+    for (const segment& seg : segments) {
+        do_copy(seg.size, seg.from, seg.to, cptype);
+    }
+}
+
+void copy::do_copy_temporary(std::size_t size, const void* from_ptr,
+                             void* to_ptr, type::copy_type cptype) const {
+
+    // Synchronous copies don't need to do anything special.
+    do_copy(size, from_ptr, to_ptr, cptype);
+}
+
+void copy::write_size(data::vector_view<char>::size_type size,
+                      data::vector_view<char>::size_type* ptr,
+                      type::copy_type cptype) const {
+
+    switch (cptype) {
+        case type::host_to_host:
+        case type::device_to_host:
+            // The target is in host memory.
+            *ptr = size;
+            break;
+        case type::host_to_device:
+        case type::device_to_device:
+            // The target is in device memory.
+            do_copy_temporary(sizeof(size), &size, ptr, type::host_to_device);
+            break;
+        default:
+            // Let the backend figure it out.
+            do_copy_temporary(sizeof(size), &size, ptr, type::unknown);
+            break;
+    }
+}
+
+copy::event_type copy::operator()(const copy_batch& batch,
+                                  type::copy_type cptype) const {
+
+    // Check if anything needs to be done.
+    if (batch.empty()) {
+        return vecmem::copy::create_event();
+    }
+
+    // Merge the segments of the batch as much as possible.
+    const std::vector<segment> segments = coalesce(batch.segments());
+
+    // Perform the copies.
+    do_copy_batch(segments, cptype);
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2,
+                     "Performed a batch of %lu copies with %lu copy "
+                     "operation(s)",
+                     batch.segments().size(), segments.size());
+
+    // Return a new event.
+    return create_event();
+}
+
+copy::event_type copy::operator()(const copy_plan& plan,
+                                  type::copy_type cptype) const {
+
+    // Perform the memory filling operations.
+    for (const copy_plan::fill& f : plan.fills()) {
+        do_memset(f.size, f.ptr, f.value);
+    }
+
+    // Copy the sizes that need to be limited to the capacities of their
+    // sources, through host memory.
+    if (!plan.size_copies().empty()) {
+        std::size_t total = 0;
+        for (const copy_plan::size_copy& sc : plan.size_copies()) {
+            total += sc.count;
+        }
+        std::vector<copy_plan::size_type> sizes(total);
+        std::vector<segment> reads;
+        reads.reserve(plan.size_copies().size());
+        std::size_t offset = 0;
+        for (const copy_plan::size_copy& sc : plan.size_copies()) {
+            reads.push_back({sc.count * sizeof(copy_plan::size_type), sc.from,
+                             sizes.data() + offset});
+            offset += sc.count;
+        }
+        do_copy_batch(reads, type::unknown);
+        create_event()->wait();
+        offset = 0;
+        for (const copy_plan::size_copy& sc : plan.size_copies()) {
+            for (std::size_t i = 0; i < sc.count; ++i) {
+                sizes[offset + i] =
+                    std::min(sizes[offset + i], sc.capacities[i]);
+            }
+            do_copy_temporary(sc.count * sizeof(copy_plan::size_type),
+                              sizes.data() + offset, sc.to, type::unknown);
+            offset += sc.count;
+        }
+    }
+
+    // Perform the copies.
+    if (!plan.segments().empty()) {
+        do_copy_batch(plan.segments(), cptype);
+    }
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2,
+                     "Replayed a plan with %lu memory filling and %lu copy "
+                     "operation(s)",
+                     plan.fills().size(), plan.segments().size());
+
+    // Return a new event.
+    return create_event();
+}
+
+std::vector<copy::segment> copy::coalesce(std::vector<segment> segments) {
+
+    // Remove the empty segments.
+    segments.erase(std::remove_if(segments.begin(), segments.end(),
+                                  [](const segment& seg) {
+                                      return seg.size == 0;
+                                  }),
+                   segments.end());
+
+    // Check if anything needs to be done.
+    if (segments.size() < 2) {
+        return segments;
+    }
+
+    // Order the segments according to their source address.
+    std::sort(segments.begin(), segments.end(),
+              [](const segment& lhs, const segment& rhs) {
+                  return std::less<const void*>()(lhs.from, rhs.from);
+              });
+
+    // Merge all segments that follow each other both in the source and in the
+    // target memory.
+    std::size_t last = 0;
+    for (std::size_t i = 1; i < segments.size(); ++i) {
+        segment& prev = segments[last];
+        const segment& next = segments[i];
+        if ((static_cast<const char*>(prev.from) + prev.size == next.from) &&
+            (static_cast<char*>(prev.to) + prev.size == next.to)) {
+            prev.size += next.size;
+        } else {
+            segments[++last] = next;
+        }
+    }
+    segments.resize(last + 1);
+
+    // Return the merged segments.
+    return segments;
+}
+
+void copy::set_staging(const staging_config& config) {
+
+    m_staging = config;
+}
+
+auto copy::get_staging() const -> const staging_config& {
+
+    return m_staging;
+}
+
+bool copy::staged_copy(const std::vector<segment>& segments,
+                       type::copy_type cptype) const {
+
+    // Check whether staging is enabled, and whether it's worth it.
+    if ((m_staging.resource == nullptr) ||
+        (segments.size() < std::max<std::size_t>(m_staging.min_segments, 2))) {
+        return false;
+    }
+    std::size_t total = 0;
+    for (const segment& seg : segments) {
+        total += seg.size;
+    }
+    if (total > m_staging.max_average_size * segments.size()) {
+        return false;
+    }
+
+    // Find the extent of the memory on the device side.
+    const bool to_device = (cptype == type::host_to_device);
+    auto device_ptr = [to_device](const segment& seg) {
+        return (to_device ? static_cast<const char*>(seg.to)
+                          : static_cast<const char*>(seg.from));
+    };
+    const char* begin = device_ptr(segments.front());
+    const char* end = begin;
+    for (const segment& seg : segments) {
+        begin = std::min(begin, device_ptr(seg), std::less<const char*>());
+        end = std::max(end, device_ptr(seg) + seg.size,
+                       std::less<const char*>());
+    }
+    const std::size_t extent = static_cast<std::size_t>(end - begin);
+
+    // Pipeline the copy if it's larger than a single chunk.
+    if ((m_staging.chunk_size != 0) && (extent > m_staging.chunk_size)) {
+        pipelined_copy(segments, begin, extent, cptype);
+        return true;
+    }
+
+    // Allocate the staging buffer.
+    unique_alloc_ptr<char[]> staging =
+        make_unique_alloc<char[]>(*(m_staging.resource), extent);
+
+    // Helper function packing/unpacking a range of segments.
+    auto pack = [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            const segment& seg = segments[i];
+            char* staged = staging.get() + (device_ptr(seg) - begin);
+            if (to_device) {
+                ::memcpy(staged, seg.from, seg.size);
+            } else {
+                ::memcpy(seg.to, staged, seg.size);
+            }
+        }
+    };
+    // Helper function packing/unpacking all segments, possibly in parallel.
+    auto pack_all = [&]() {
+        if (m_staging.pool == nullptr) {
+            pack(0, segments.size());
+            return;
+        }
+        const std::size_t n_tasks =
+            std::min(m_staging.pool->size() + 1, segments.size());
+        m_staging.pool->parallel_for(n_tasks, [&](std::size_t i) {
+            pack(i * segments.size() / n_tasks,
+                 (i + 1) * segments.size() / n_tasks);
+        });
+    };
+
+    // Perform the staged copy.
+    if (to_device) {
+        pack_all();
+        do_copy(extent, staging.get(), const_cast<char*>(begin), cptype);
+        create_event()->wait();
+    } else {
+        do_copy(extent, begin, staging.get(), cptype);
+        create_event()->wait();
+        pack_all();
+    }
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2,
+                     "Performed %lu copies through a staging buffer of %lu "
+                     "bytes",
+                     segments.size(), extent);
+    return true;
+}
+
+bool copy::pipelined_copy(std::size_t size, const void* from, void* to,
+                          type::copy_type cptype) const {
+
+    // Check whether pipelining is enabled, and whether it's appropriate.
+    if ((m_staging.resource == nullptr) || (m_staging.chunk_size == 0) ||
+        (size <= m_staging.chunk_size) ||
+        ((cptype != type::host_to_device) &&
+         (cptype != type::device_to_host))) {
+        return false;
+    }
+
+    // Perform the copy.
+    const char* device_ptr = static_cast<const char*>(
+        (cptype == type::host_to_device) ? to : from);
+    pipelined_copy({{size, from, to}}, device_ptr, size, cptype);
+    return true;
+}
+
+void copy::pipelined_copy(const std::vector<segment>& segments,
+                          const char* begin, std::size_t extent,
+                          type::copy_type cptype) const {
+
+    // Order the segments according to their device side address.
+    const bool to_device = (cptype == type::host_to_device);
+    auto device_ptr = [to_device](const segment& seg) {
+        return (to_device ? static_cast<const char*>(seg.to)
+                          : static_cast<const char*>(seg.from));
+    };
+    std::vector<segment> sorted = segments;
+    std::sort(sorted.begin(), sorted.end(),
+              [&device_ptr](const segment& lhs, const segment& rhs) {
+                  return std::less<const char*>()(device_ptr(lhs),
+                                                  device_ptr(rhs));
+              });
+
+    // Allocate the rotating staging buffers.
+    const std::size_t chunk = m_staging.chunk_size;
+    const std::size_t n_chunks = (extent + chunk - 1) / chunk;
+    const std::size_t n_buffers =
+        std::min(std::max<std::size_t>(m_staging.n_buffers, 1), n_chunks);
+    unique_alloc_ptr<char[]> staging =
+        make_unique_alloc<char[]>(*(m_staging.resource), n_buffers * chunk);
+
+    // Helper functions describing a chunk.
+    auto chunk_begin = [&](std::size_t i) { return begin + i * chunk; };
+    auto chunk_size = [&](std::size_t i) {
+        return std::min(chunk, extent - i * chunk);
+    };
+    auto buffer = [&](std::size_t i) {
+        return staging.get() + (i % n_buffers) * chunk;
+    };
+
+    // The host side of the pipeline, packing/unpacking one chunk.
+    auto host_stage = [&](std::size_t i) {
+        const char* first = chunk_begin(i);
+        const char* last = first + chunk_size(i);
+        // Find the first segment overlapping with the chunk.
+        auto it = std::partition_point(
+            sorted.begin(), sorted.end(), [&](const segment& seg) {
+                return !std::less<const char*>()(first,
+                                                 device_ptr(seg) + seg.size);
+            });
+        for (; (it != sorted.end()) &&
+               std::less<const char*>()(device_ptr(*it), last);
+             ++it) {
+            const char* dev = device_ptr(*it);
+            const char* lo = std::max(dev, first, std::less<const char*>());
+            const char* hi =
+                std::min(dev + it->size, last, std::less<const char*>());
+            char* staged = buffer(i) + (lo - first);
+            if (to_device) {
+                ::memcpy(staged,
+                         static_cast<const char*>(it->from) + (lo - dev),
+                         static_cast<std::size_t>(hi - lo));
+            } else {
+                ::memcpy(static_cast<char*>(it->to) + (lo - dev), staged,
+                         static_cast<std::size_t>(hi - lo));
+            }
+        }
+    };
+    // The device side of the pipeline, transferring one chunk.
+    auto device_stage = [&](std::size_t i) {
+        if (to_device) {
+            do_copy(chunk_size(i), buffer(i), const_cast<char*>(chunk_begin(i)),
+                    cptype);
+        } else {
+            do_copy(chunk_size(i), chunk_begin(i), buffer(i), cptype);
+        }
+        create_event()->wait();
+    };
+
+    // Run the pipeline.
+    run_pipeline(n_chunks, n_buffers, to_device, host_stage, device_stage);
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2,
+                     "Performed %lu copies of %lu bytes in %lu pipelined "
+                     "chunk(s)",
+                     segments.size(), extent, n_chunks);
+}
+
+void copy::set_compression(const compression_config& config) {
+
+    m_compression = config;
+}
+
+auto copy::get_compression() const -> const compression_config& {
+
+    return m_compression;
+}
+
+bool copy::compressed_copy(std::size_t size, const void* from, void* to,
+                           type::copy_type cptype) const {
+
+    // Check whether compression is enabled, and whether it's appropriate.
+    if ((m_compression.compressor == nullptr) ||
+        (cptype != type::host_to_host) || (size < m_compression.threshold)) {
+        return false;
+    }
+    const codec& compressor = *(m_compression.compressor);
+
+    // Allocate the buffers for the compressed data, on the sending and on the
+    // receiving side.
+    host_memory_resource host_mr;
+    memory_resource& mr = ((m_compression.resource != nullptr)
+                               ? *(m_compression.resource)
+                               : host_mr);
+    const std::size_t capacity = compressor.max_compressed_size(size);
+    unique_alloc_ptr<char[]> sent = make_unique_alloc<char[]>(mr, capacity);
+    unique_alloc_ptr<char[]> received =
+        make_unique_alloc<char[]>(mr, capacity);
+
+    // Compress the data, and only proceed if it's worth it.
+    const std::size_t compressed_size = compressor.compress(
+        from, size, sent.get(), capacity, m_compression.pool);
+    if (compressed_size >= size) {
+        return false;
+    }
+
+    // Transfer and decompress the data.
+    do_copy(compressed_size, sent.get(), received.get(), cptype);
+    create_event()->wait();
+    compressor.decompress(received.get(), compressed_size, to, size,
+                          m_compression.pool);
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2, "Performed a compressed copy of %lu bytes as %lu bytes",
+                     size, compressed_size);
+    return true;
+}
+
 copy::event_type copy::create_event() const {
 
-    // Make a no-op event.
-    return std::make_unique<noop_event>();
+    // Hand out the (stateless) no-op event, without any allocation.
+    static noop_event event;
+    return event_type(&event, details::event_deleter::non_owning());
 }
 
 }  // namespace vecmem
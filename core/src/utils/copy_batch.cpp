@@ -0,0 +1,44 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/copy_batch.hpp"
+
+namespace vecmem {
+
+copy_batch::copy_batch(const copy& engine) : m_copy(engine) {}
+
+copy_batch& copy_batch::add(std::size_t size, const void* from, void* to) {
+
+    // Ignore empty copies.
+    if (size == 0) {
+        return *this;
+    }
+
+    // Remember the copy.
+    m_segments.push_back({size, from, to});
+    return *this;
+}
+
+auto copy_batch::segments() const -> const std::vector<segment>& {
+
+    return m_segments;
+}
+
+bool copy_batch::empty() const {
+
+    return m_segments.empty();
+}
+
+void copy_batch::clear() {
+
+    m_segments.clear();
+    m_sizes.clear();
+}
+
+}  // namespace vecmem
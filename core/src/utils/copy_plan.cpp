@@ -0,0 +1,144 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/copy_plan.hpp"
+
+// System include(s).
+#include <cassert>
+#include <utility>
+
+namespace vecmem {
+
+std::size_t copy_plan::bindings() const {
+
+    return m_bindings.size();
+}
+
+auto copy_plan::segments() const -> const std::vector<segment>& {
+
+    if (!m_resolved) {
+        resolve();
+    }
+    return m_resolved_segments;
+}
+
+auto copy_plan::fills() const -> const std::vector<fill>& {
+
+    if (!m_resolved) {
+        resolve();
+    }
+    return m_resolved_fills;
+}
+
+auto copy_plan::size_copies() const -> const std::vector<size_copy>& {
+
+    if (!m_resolved) {
+        resolve();
+    }
+    return m_resolved_size_copies;
+}
+
+bool copy_plan::empty() const {
+
+    return (m_copies.empty() && m_fills.empty() && m_size_copies.empty());
+}
+
+copy_plan::binding_id copy_plan::add_binding(std::uintptr_t base) {
+
+    m_bindings.push_back(base);
+    return m_bindings.size() - 1;
+}
+
+void copy_plan::set_binding(binding_id id, std::uintptr_t base) {
+
+    // A sanity check.
+    if (id >= m_bindings.size()) {
+        throw std::out_of_range("Unknown binding requested");
+    }
+
+    // Update the binding.
+    m_bindings[id] = base;
+    m_resolved = false;
+}
+
+auto copy_plan::make_endpoint(binding_id id, const void* ptr) const
+    -> endpoint {
+
+    assert(id < m_bindings.size());
+    return {id, reinterpret_cast<std::uintptr_t>(ptr) - m_bindings[id]};
+}
+
+void copy_plan::add_copy(std::size_t size, binding_id from_id,
+                         const void* from, binding_id to_id, void* to) {
+
+    // Ignore empty copies.
+    if (size == 0) {
+        return;
+    }
+
+    // Remember the copy.
+    m_copies.push_back(
+        {size, make_endpoint(from_id, from), make_endpoint(to_id, to)});
+    m_resolved = false;
+}
+
+void copy_plan::add_size_copy(std::vector<size_type>&& capacities,
+                              binding_id from_id, const size_type* from,
+                              binding_id to_id, size_type* to) {
+
+    // Ignore empty copies.
+    if (capacities.empty()) {
+        return;
+    }
+
+    // Remember the copy.
+    const std::size_t count = capacities.size();
+    m_sizes.push_back(std::move(capacities));
+    m_size_copies.push_back({count, make_endpoint(from_id, from),
+                             make_endpoint(to_id, to), m_sizes.size() - 1});
+    m_resolved = false;
+}
+
+void copy_plan::resolve() const {
+
+    // Helper function turning an endpoint into an absolute address.
+    auto address = [this](const endpoint& ep) {
+        return reinterpret_cast<void*>(m_bindings[ep.binding] + ep.offset);
+    };
+
+    // Resolve the copies, merging the ones that are adjacent.
+    std::vector<segment> segments;
+    segments.reserve(m_copies.size());
+    for (const copy_op& op : m_copies) {
+        segments.push_back({op.size, address(op.from), address(op.to)});
+    }
+    m_resolved_segments = copy::coalesce(std::move(segments));
+
+    // Resolve the memory filling operations.
+    m_resolved_fills.clear();
+    m_resolved_fills.reserve(m_fills.size());
+    for (const fill_op& op : m_fills) {
+        m_resolved_fills.push_back({op.size, address(op.ptr), op.value});
+    }
+
+    // Resolve the size copies.
+    m_resolved_size_copies.clear();
+    m_resolved_size_copies.reserve(m_size_copies.size());
+    for (const size_copy_op& op : m_size_copies) {
+        m_resolved_size_copies.push_back(
+            {op.count, static_cast<const size_type*>(address(op.from)),
+             static_cast<size_type*>(address(op.to)),
+             m_sizes[op.capacities].data()});
+    }
+
+    // The resolved operations are now up to date.
+    m_resolved = true;
+}
+
+}  // namespace vecmem
@@ -0,0 +1,321 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/delta_bitpack_codec.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+/// The number of elements packed together with the same bit width
+constexpr std::size_t block_size = 128;
+
+/// Load one integer of a given size
+std::uint64_t load(const unsigned char* ptr, std::size_t element_size) {
+
+    if (element_size == 4) {
+        std::uint32_t result;
+        std::memcpy(&result, ptr, sizeof(result));
+        return result;
+    }
+    std::uint64_t result;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+/// Store one integer of a given size
+void store(std::uint64_t value, unsigned char* ptr, std::size_t element_size) {
+
+    if (element_size == 4) {
+        const std::uint32_t narrow = static_cast<std::uint32_t>(value);
+        std::memcpy(ptr, &narrow, sizeof(narrow));
+    } else {
+        std::memcpy(ptr, &value, sizeof(value));
+    }
+}
+
+/// Zig-zag encode the difference of two integers of a given size
+std::uint64_t encode(std::uint64_t value, std::uint64_t previous,
+                     std::size_t element_size) {
+
+    if (element_size == 4) {
+        const std::int32_t delta = static_cast<std::int32_t>(
+            static_cast<std::uint32_t>(value - previous));
+        return static_cast<std::uint32_t>(
+            (static_cast<std::uint32_t>(delta) << 1) ^
+            static_cast<std::uint32_t>(delta >> 31));
+    }
+    const std::int64_t delta = static_cast<std::int64_t>(value - previous);
+    return (static_cast<std::uint64_t>(delta) << 1) ^
+           static_cast<std::uint64_t>(delta >> 63);
+}
+
+/// Decode a zig-zag encoded difference of two integers
+std::uint64_t decode(std::uint64_t code, std::uint64_t previous,
+                     std::size_t element_size) {
+
+    const std::uint64_t delta = (code >> 1) ^ (~(code & 1) + 1);
+    const std::uint64_t result = previous + delta;
+    return ((element_size == 4) ? (result & 0xffffffffu) : result);
+}
+
+/// Get the number of bits needed to store a value
+unsigned int bit_width(std::uint64_t value) {
+
+    unsigned int result = 0;
+    for (; value != 0; value >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+/// Helper writing a bit stream, with bounds checking
+class bit_writer {
+
+public:
+    /// Constructor with the output memory block
+    bit_writer(unsigned char* out, std::size_t capacity)
+        : m_ptr(out), m_begin(out), m_end(out + capacity) {}
+
+    /// Write a full byte (after flushing the pending bits)
+    bool put_byte(unsigned char value) {
+        return (flush() && put(value));
+    }
+    /// Write the lowest @c bits bits of a value
+    bool put_bits(std::uint64_t value, unsigned int bits) {
+        if (bits > 32) {
+            return (put_bits(value & 0xffffffffu, 32) &&
+                    put_bits(value >> 32, bits - 32));
+        }
+        m_buffer |= (value & ((std::uint64_t(1) << bits) - 1)) << m_n_bits;
+        m_n_bits += bits;
+        while (m_n_bits >= 8) {
+            if (!put(static_cast<unsigned char>(m_buffer & 0xff))) {
+                return false;
+            }
+            m_buffer >>= 8;
+            m_n_bits -= 8;
+        }
+        return true;
+    }
+    /// Write the pending bits, padded to a full byte
+    bool flush() {
+        if (m_n_bits == 0) {
+            return true;
+        }
+        m_n_bits = 0;
+        const unsigned char value = static_cast<unsigned char>(m_buffer);
+        m_buffer = 0;
+        return put(value);
+    }
+    /// Write a block of bytes (after flushing the pending bits)
+    bool put_bytes(const unsigned char* data, std::size_t size) {
+        if ((!flush()) || (static_cast<std::size_t>(m_end - m_ptr) < size)) {
+            return false;
+        }
+        std::memcpy(m_ptr, data, size);
+        m_ptr += size;
+        return true;
+    }
+    /// Get the number of bytes written
+    std::size_t size() const {
+        return static_cast<std::size_t>(m_ptr - m_begin);
+    }
+
+private:
+    /// Write one byte
+    bool put(unsigned char value) {
+        if (m_ptr == m_end) {
+            return false;
+        }
+        *(m_ptr++) = value;
+        return true;
+    }
+
+    /// The current position
+    unsigned char* m_ptr;
+    /// The beginning of the output
+    unsigned char* m_begin;
+    /// The end of the output
+    unsigned char* m_end;
+    /// The bits not written to the output yet
+    std::uint64_t m_buffer = 0;
+    /// The number of bits not written to the output yet
+    unsigned int m_n_bits = 0;
+
+};  // class bit_writer
+
+/// Helper reading a bit stream, with bounds checking
+class bit_reader {
+
+public:
+    /// Constructor with the input memory block
+    bit_reader(const unsigned char* in, std::size_t size)
+        : m_ptr(in), m_end(in + size) {}
+
+    /// Read a full byte (dropping the pending bits)
+    unsigned char get_byte() {
+        m_buffer = 0;
+        m_n_bits = 0;
+        return get();
+    }
+    /// Read a value of @c bits bits
+    std::uint64_t get_bits(unsigned int bits) {
+        if (bits > 32) {
+            const std::uint64_t low = get_bits(32);
+            return (low | (get_bits(bits - 32) << 32));
+        }
+        while (m_n_bits < bits) {
+            m_buffer |= static_cast<std::uint64_t>(get()) << m_n_bits;
+            m_n_bits += 8;
+        }
+        const std::uint64_t result =
+            m_buffer & ((std::uint64_t(1) << bits) - 1);
+        m_buffer >>= bits;
+        m_n_bits -= bits;
+        return result;
+    }
+    /// Read a block of bytes (dropping the pending bits)
+    void get_bytes(unsigned char* data, std::size_t size) {
+        m_buffer = 0;
+        m_n_bits = 0;
+        if (static_cast<std::size_t>(m_end - m_ptr) < size) {
+            throw std::runtime_error("Truncated bit-packed stream");
+        }
+        std::memcpy(data, m_ptr, size);
+        m_ptr += size;
+    }
+    /// Check whether all of the input was read
+    bool done() const { return (m_ptr == m_end); }
+
+private:
+    /// Read one byte
+    unsigned char get() {
+        if (m_ptr == m_end) {
+            throw std::runtime_error("Truncated bit-packed stream");
+        }
+        return *(m_ptr++);
+    }
+
+    /// The current position
+    const unsigned char* m_ptr;
+    /// The end of the input
+    const unsigned char* m_end;
+    /// The bits read from the input, but not used yet
+    std::uint64_t m_buffer = 0;
+    /// The number of bits read from the input, but not used yet
+    unsigned int m_n_bits = 0;
+
+};  // class bit_reader
+
+}  // namespace
+
+namespace vecmem {
+
+delta_bitpack_codec::delta_bitpack_codec(std::size_t element_size,
+                                         std::size_t chunk_size)
+    : codec(std::max(chunk_size - chunk_size % 8, std::size_t(8))),
+      m_element_size(element_size) {
+
+    if ((m_element_size != 4) && (m_element_size != 8)) {
+        throw std::invalid_argument("The element size must be 4 or 8");
+    }
+}
+
+std::size_t delta_bitpack_codec::element_size() const {
+
+    return m_element_size;
+}
+
+std::size_t delta_bitpack_codec::do_max_compressed_size(
+    std::size_t size) const {
+
+    return size + size / (block_size * m_element_size) + 2;
+}
+
+std::size_t delta_bitpack_codec::do_compress(const void* in, std::size_t size,
+                                             void* out,
+                                             std::size_t capacity) const {
+
+    const unsigned char* input = static_cast<const unsigned char*>(in);
+    bit_writer output(static_cast<unsigned char*>(out), capacity);
+
+    // Encode the elements in blocks.
+    const std::size_t n_elements = size / m_element_size;
+    std::uint64_t previous = 0;
+    std::uint64_t codes[block_size];
+    for (std::size_t begin = 0; begin < n_elements; begin += block_size) {
+
+        // Calculate the codes of the block, and the bit width needed.
+        const std::size_t n = std::min(block_size, n_elements - begin);
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::uint64_t value =
+                load(input + (begin + i) * m_element_size, m_element_size);
+            codes[i] = encode(value, previous, m_element_size);
+            mask |= codes[i];
+            previous = value;
+        }
+        const unsigned int bits = bit_width(mask);
+
+        // Write the block.
+        if (!output.put_byte(static_cast<unsigned char>(bits))) {
+            return 0;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!output.put_bits(codes[i], bits)) {
+                return 0;
+            }
+        }
+    }
+
+    // Store the trailing bytes as-is.
+    const std::size_t n_encoded = n_elements * m_element_size;
+    if (!output.put_bytes(input + n_encoded, size - n_encoded)) {
+        return 0;
+    }
+    return output.size();
+}
+
+void delta_bitpack_codec::do_decompress(const void* in,
+                                        std::size_t compressed_size,
+                                        void* out, std::size_t size) const {
+
+    bit_reader input(static_cast<const unsigned char*>(in), compressed_size);
+    unsigned char* output = static_cast<unsigned char*>(out);
+
+    // Decode the elements in blocks.
+    const std::size_t n_elements = size / m_element_size;
+    std::uint64_t previous = 0;
+    for (std::size_t begin = 0; begin < n_elements; begin += block_size) {
+        const std::size_t n = std::min(block_size, n_elements - begin);
+        const unsigned int bits = input.get_byte();
+        if (bits > 8 * m_element_size) {
+            throw std::runtime_error("Corrupt bit-packed stream");
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            previous = decode(input.get_bits(bits), previous, m_element_size);
+            store(previous, output + (begin + i) * m_element_size,
+                  m_element_size);
+        }
+    }
+
+    // Copy the trailing bytes.
+    const std::size_t n_encoded = n_elements * m_element_size;
+    input.get_bytes(output + n_encoded, size - n_encoded);
+    if (!input.done()) {
+        throw std::runtime_error("Corrupt bit-packed stream");
+    }
+}
+
+}  // namespace vecmem
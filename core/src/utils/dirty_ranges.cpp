@@ -0,0 +1,114 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/dirty_ranges.hpp"
+
+// System include(s).
+#include <algorithm>
+
+namespace vecmem {
+
+dirty_ranges::dirty_ranges(size_type merge_gap) : m_merge_gap(merge_gap) {}
+
+void dirty_ranges::mark(size_type index) {
+
+    mark(index, index + 1);
+}
+
+void dirty_ranges::mark(size_type begin, size_type end) {
+
+    // Ignore empty ranges.
+    if (begin >= end) {
+        return;
+    }
+
+    // Extend the last range if possible. This makes sequential modifications
+    // cheap to record.
+    if (!m_ranges.empty()) {
+        range& last = m_ranges.back();
+        if ((begin <= last.end + m_merge_gap) &&
+            (last.begin <= end + m_merge_gap)) {
+            last.begin = std::min(last.begin, begin);
+            last.end = std::max(last.end, end);
+            m_sorted = (m_ranges.size() == 1);
+            return;
+        }
+    }
+
+    // Record a new range.
+    m_ranges.push_back({begin, end});
+    m_sorted = (m_ranges.size() == 1);
+
+    // Don't let the number of recorded ranges grow without bounds.
+    if (m_ranges.size() > 2 * m_compacted + 64) {
+        compact();
+    }
+}
+
+bool dirty_ranges::empty() const {
+
+    return m_ranges.empty();
+}
+
+void dirty_ranges::clear() {
+
+    m_ranges.clear();
+    m_compacted = 0;
+    m_sorted = true;
+}
+
+auto dirty_ranges::ranges() const -> const std::vector<range>& {
+
+    compact();
+    return m_ranges;
+}
+
+auto dirty_ranges::merge_gap() const -> size_type {
+
+    return m_merge_gap;
+}
+
+void dirty_ranges::set_merge_gap(size_type gap) {
+
+    m_merge_gap = gap;
+    m_sorted = (m_ranges.size() < 2);
+}
+
+void dirty_ranges::compact() const {
+
+    // Check if anything needs to be done.
+    if (m_sorted) {
+        return;
+    }
+
+    // Order the ranges according to their first index.
+    std::sort(m_ranges.begin(), m_ranges.end(),
+              [](const range& lhs, const range& rhs) {
+                  return lhs.begin < rhs.begin;
+              });
+
+    // Merge the ranges that overlap, or are closer than the merge gap.
+    std::size_t last = 0;
+    for (std::size_t i = 1; i < m_ranges.size(); ++i) {
+        range& prev = m_ranges[last];
+        const range& next = m_ranges[i];
+        if (next.begin <= prev.end + m_merge_gap) {
+            prev.end = std::max(prev.end, next.end);
+        } else {
+            m_ranges[++last] = next;
+        }
+    }
+    m_ranges.resize(last + 1);
+
+    // Remember the result.
+    m_compacted = m_ranges.size();
+    m_sorted = true;
+}
+
+}  // namespace vecmem
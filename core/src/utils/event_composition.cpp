@@ -0,0 +1,319 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/event_composition.hpp"
+
+#include "vecmem/utils/host_event.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/// Event completing once all of its input events did
+struct all_event : public vecmem::abstract_event {
+
+    /// Constructor with the input events
+    all_event(std::vector<vecmem::event_ptr> events)
+        : m_events(std::move(events)) {}
+
+    /// Wait for all input events, one by one
+    virtual void wait() override {
+        for (vecmem::event_ptr& event : m_events) {
+            event->wait();
+        }
+    }
+    /// Check whether all input events are complete
+    virtual bool is_ready() override {
+        return std::all_of(
+            m_events.begin(), m_events.end(),
+            [](vecmem::event_ptr& event) { return event->is_ready(); });
+    }
+
+    /// The input events
+    std::vector<vecmem::event_ptr> m_events;
+
+};  // struct all_event
+
+/// Event completing once any of its input events did
+struct any_event : public vecmem::abstract_event {
+
+    /// Constructor with the input events
+    any_event(std::vector<vecmem::event_ptr> events)
+        : m_events(std::move(events)) {}
+
+    /// Poll the input events until one of them is complete
+    virtual void wait() override {
+        std::chrono::microseconds delay(1);
+        static constexpr std::chrono::microseconds max_delay(100);
+        while (true) {
+            for (vecmem::event_ptr& event : m_events) {
+                if (event->is_ready()) {
+                    // Let the event re-throw its error, if it has one.
+                    event->wait();
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(delay);
+            delay = std::min(delay * 2, max_delay);
+        }
+    }
+    /// Check whether any of the input events is complete
+    virtual bool is_ready() override {
+        return std::any_of(
+            m_events.begin(), m_events.end(),
+            [](vecmem::event_ptr& event) { return event->is_ready(); });
+    }
+
+    /// The input events
+    std::vector<vecmem::event_ptr> m_events;
+
+};  // struct any_event
+
+/// Thread watching over events that do not provide completion callbacks
+class event_watcher {
+
+public:
+    /// Start the watcher thread
+    event_watcher() : m_thread([this]() { run(); }) {}
+    /// Stop the watcher thread
+    ~event_watcher() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    /// Start watching an event
+    void add(vecmem::abstract_event& event, std::function<void()> callback) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_added.push_back({&event, std::move(callback)});
+        }
+        m_cv.notify_all();
+    }
+
+private:
+    /// An event being watched, with the function to call once it completes
+    typedef std::pair<vecmem::abstract_event*, std::function<void()> > entry;
+
+    /// Function executed by the watcher thread
+    void run() {
+
+        // The events being watched. Only accessed by this thread.
+        std::vector<entry> watched;
+        // The delay between two checks of the events.
+        static constexpr std::chrono::microseconds min_delay(1);
+        static constexpr std::chrono::microseconds max_delay(1000);
+        std::chrono::microseconds delay = min_delay;
+
+        while (true) {
+            // Pick up the newly added events, waiting for some if there are
+            // none to watch.
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (watched.empty()) {
+                    m_cv.wait(lock,
+                              [this]() { return m_stop || !m_added.empty(); });
+                } else {
+                    m_cv.wait_for(lock, delay, [this]() {
+                        return m_stop || !m_added.empty();
+                    });
+                }
+                if (m_stop) {
+                    return;
+                }
+                std::move(m_added.begin(), m_added.end(),
+                          std::back_inserter(watched));
+                m_added.clear();
+            }
+
+            // Check the events, calling the functions of the completed ones.
+            const auto completed = std::stable_partition(
+                watched.begin(), watched.end(),
+                [](const entry& e) { return !e.first->is_ready(); });
+            const bool progress = (completed != watched.end());
+            std::vector<entry> done(std::make_move_iterator(completed),
+                                    std::make_move_iterator(watched.end()));
+            watched.erase(completed, watched.end());
+            for (entry& e : done) {
+                e.second();
+            }
+
+            // Check more often while events are completing.
+            delay = (progress ? min_delay : std::min(delay * 2, max_delay));
+        }
+    }
+
+    /// Events added since the last check
+    std::vector<entry> m_added;
+    /// Flag telling the thread to stop
+    bool m_stop = false;
+    /// Mutex protecting the members of the object
+    std::mutex m_mutex;
+    /// Condition variable used to wake up the thread
+    std::condition_variable m_cv;
+    /// The watcher thread
+    std::thread m_thread;
+
+};  // class event_watcher
+
+/// Helper function checking if all events are host events
+bool all_host_events(const std::vector<vecmem::event_ptr>& events) {
+
+    return std::all_of(events.begin(), events.end(),
+                       [](const vecmem::event_ptr& event) {
+                           return dynamic_cast<const vecmem::host_event*>(
+                                      event.get()) != nullptr;
+                       });
+}
+
+/// State of a @c when_all call on host events
+struct when_all_state {
+
+    /// Constructor with the number of input events
+    when_all_state(std::size_t n_events) : m_remaining(n_events) {}
+
+    /// The number of input events that did not complete yet
+    std::size_t m_remaining;
+    /// The first error encountered
+    std::exception_ptr m_error;
+    /// Mutex protecting the members of the object
+    std::mutex m_mutex;
+
+};  // struct when_all_state
+
+}  // namespace
+
+namespace vecmem {
+
+event_ptr when_all(std::vector<event_ptr> events) {
+
+    // Handle the trivial case(s).
+    if (events.empty()) {
+        host_event result;
+        result.complete();
+        return std::make_unique<host_event>(result);
+    }
+    if (events.size() == 1) {
+        return std::move(events.front());
+    }
+
+    // Combine generic events in the simplest way.
+    if (!all_host_events(events)) {
+        return std::make_unique<all_event>(std::move(events));
+    }
+
+    // Complete the result when the last input event completes.
+    host_event result;
+    auto state = std::make_shared<when_all_state>(events.size());
+    for (event_ptr& event : events) {
+        const host_event input = static_cast<host_event&>(*event);
+        input.then([input, state, result]() {
+            std::exception_ptr error = input.error();
+            std::lock_guard<std::mutex> lock(state->m_mutex);
+            if (error && !state->m_error) {
+                state->m_error = error;
+            }
+            if (--(state->m_remaining) == 0) {
+                result.complete(state->m_error);
+            }
+        });
+    }
+    return std::make_unique<host_event>(result);
+}
+
+event_ptr when_any(std::vector<event_ptr> events) {
+
+    // Handle the trivial case(s).
+    if (events.empty()) {
+        throw std::invalid_argument(
+            "when_any(...) needs at least one event");
+    }
+    if (events.size() == 1) {
+        return std::move(events.front());
+    }
+
+    // Combine generic events in the simplest way.
+    if (!all_host_events(events)) {
+        return std::make_unique<any_event>(std::move(events));
+    }
+
+    // Complete the result when the first input event completes.
+    host_event result;
+    for (event_ptr& event : events) {
+        const host_event input = static_cast<host_event&>(*event);
+        input.then([input, result]() { result.complete(input.error()); });
+    }
+    return std::make_unique<host_event>(result);
+}
+
+event_ptr then(event_ptr event, std::function<void()> callback,
+               thread_pool& pool) {
+
+    // The event signalling the completion of the callback.
+    host_event result;
+
+    // The task executing the callback on the pool.
+    auto task = [callback = std::move(callback), result]() {
+        try {
+            callback();
+        } catch (...) {
+            result.complete(std::current_exception());
+            return;
+        }
+        result.complete();
+    };
+
+    // Submit the task to the pool once the event is complete, without
+    // blocking any of the pool's workers while waiting for it.
+    std::shared_ptr<abstract_event> input(std::move(event));
+    on_ready(*input, [input, result, task, &pool]() {
+        // Let the (complete) event re-throw its error, if it has one.
+        try {
+            input->wait();
+        } catch (...) {
+            result.complete(std::current_exception());
+            return;
+        }
+        pool.submit(task);
+    });
+    return std::make_unique<host_event>(result);
+}
+
+void on_ready(abstract_event& event, std::function<void()> callback) {
+
+    // Rely on the callbacks of host events.
+    if (const host_event* host = dynamic_cast<const host_event*>(&event)) {
+        host->then(std::move(callback));
+        return;
+    }
+
+    // Don't bother the watcher with complete events.
+    if (event.is_ready()) {
+        callback();
+        return;
+    }
+
+    // Let the watcher thread handle all other events.
+    static event_watcher watcher;
+    watcher.add(event, std::move(callback));
+}
+
+}  // namespace vecmem
@@ -0,0 +1,81 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/event_pool.hpp"
+
+// System include(s).
+#include <utility>
+
+namespace vecmem {
+namespace details {
+
+event_deleter::event_deleter(std::shared_ptr<event_pool> pool)
+    : m_pool(std::move(pool)) {}
+
+event_deleter event_deleter::non_owning() {
+
+    event_deleter result;
+    result.m_owning = false;
+    return result;
+}
+
+void event_deleter::operator()(abstract_event* event) const {
+
+    if (!m_owning) {
+        return;
+    }
+    if (m_pool) {
+        m_pool->release(event);
+    } else {
+        delete event;
+    }
+}
+
+}  // namespace details
+
+event_pool::event_pool(std::size_t max_size) : m_max_size(max_size) {}
+
+event_pool::~event_pool() {}
+
+std::unique_ptr<abstract_event> event_pool::acquire() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_events.empty()) {
+        return nullptr;
+    }
+    std::unique_ptr<abstract_event> result = std::move(m_events.back());
+    m_events.pop_back();
+    return result;
+}
+
+event_ptr event_pool::make_pooled(std::unique_ptr<abstract_event> event) {
+
+    return event_ptr(event.release(),
+                     details::event_deleter(shared_from_this()));
+}
+
+void event_pool::release(abstract_event* event) {
+
+    // Take ownership of the event.
+    std::unique_ptr<abstract_event> ptr(event);
+
+    // Keep it, if there is still space in the pool.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_events.size() < m_max_size) {
+        m_events.push_back(std::move(ptr));
+    }
+}
+
+std::size_t event_pool::size() const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events.size();
+}
+
+}  // namespace vecmem
@@ -0,0 +1,274 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/host/async_copy.hpp"
+
+#include "vecmem/utils/debug.hpp"
+#include "vecmem/utils/host_event.hpp"
+
+// System include(s).
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vecmem::host {
+namespace details {
+
+/// In-order queue of the operations issued by @c vecmem::host::async_copy
+///
+/// At most one task is processing the queue on the thread pool at any time,
+/// which is what guarantees the in-order execution of the operations.
+///
+struct async_copy_queue
+    : public std::enable_shared_from_this<async_copy_queue> {
+
+    /// Constructor with the thread pool to use
+    async_copy_queue(thread_pool& pool) : m_pool(pool) {}
+
+    /// Add an operation to the queue
+    void enqueue(std::function<void()> op) {
+
+        bool start = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_ops.push_back(std::move(op));
+            if (!m_running) {
+                m_running = true;
+                start = true;
+            }
+        }
+        if (start) {
+            auto self = shared_from_this();
+            m_pool.submit([self]() { self->process(); });
+        }
+    }
+
+    /// Execute the queued operations, until the queue is empty
+    void process() {
+
+        while (true) {
+            std::function<void()> op;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_ops.empty()) {
+                    m_running = false;
+                    m_cv.notify_all();
+                    return;
+                }
+                op = std::move(m_ops.front());
+                m_ops.pop_front();
+            }
+            try {
+                op();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    /// Check whether there are no operations queued or running
+    ///
+    /// It has to be called with @c m_mutex locked.
+    ///
+    bool idle() const { return (!m_running) && m_ops.empty(); }
+
+    /// Wait for all queued operations to finish
+    void wait_idle() {
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return idle(); });
+    }
+
+    /// Take the error encountered by the operations (if any)
+    ///
+    /// It has to be called with @c m_mutex locked.
+    ///
+    std::exception_ptr take_error() {
+
+        std::exception_ptr result;
+        std::swap(result, m_error);
+        return result;
+    }
+
+    /// The thread pool processing the operations
+    thread_pool& m_pool;
+    /// The queued operations
+    std::deque<std::function<void()> > m_ops;
+    /// Flag showing whether a task is processing the queue
+    bool m_running = false;
+    /// The first error encountered by the operations
+    std::exception_ptr m_error;
+    /// Mutex protecting the members of the object
+    std::mutex m_mutex;
+    /// Condition variable used to signal that the queue became idle
+    std::condition_variable m_cv;
+
+};  // struct async_copy_queue
+
+}  // namespace details
+
+async_copy::async_copy(std::size_t n_threads)
+    : async_copy(n_threads, config{}) {}
+
+async_copy::async_copy(std::size_t n_threads, const config& cfg)
+    : m_owned_pool(std::make_unique<thread_pool>(n_threads)),
+      m_pool(*m_owned_pool),
+      m_config(cfg),
+      m_queue(std::make_shared<details::async_copy_queue>(m_pool)) {}
+
+async_copy::async_copy(thread_pool& pool) : async_copy(pool, config{}) {}
+
+async_copy::async_copy(thread_pool& pool, const config& cfg)
+    : m_owned_pool(),
+      m_pool(pool),
+      m_config(cfg),
+      m_queue(std::make_shared<details::async_copy_queue>(m_pool)) {}
+
+async_copy::~async_copy() {
+
+    // Make sure that no operation would be left running.
+    m_queue->wait_idle();
+}
+
+auto async_copy::get_config() const -> const config& {
+
+    return m_config;
+}
+
+void async_copy::do_copy(std::size_t size, const void* from_ptr, void* to_ptr,
+                         type::copy_type cptype) const {
+
+    // Perform small copies on the calling thread.
+    if (size <= m_config.sync_threshold) {
+        m_queue->wait_idle();
+        copy::do_copy(size, from_ptr, to_ptr, cptype);
+        return;
+    }
+
+    // Queue the copy.
+    m_queue->enqueue([this, size, from_ptr, to_ptr, cptype]() {
+        copy::do_copy(size, from_ptr, to_ptr, cptype);
+    });
+    VECMEM_DEBUG_MSG(1,
+                     "Queued asynchronous memory copy of %lu bytes from %p "
+                     "to %p",
+                     size, from_ptr, to_ptr);
+}
+
+void async_copy::do_copy_batch(const std::vector<segment>& segments,
+                               type::copy_type cptype) const {
+
+    // Calculate the total amount of data to copy.
+    std::size_t total = 0;
+    for (const segment& seg : segments) {
+        total += seg.size;
+    }
+
+    // Perform small batches on the calling thread. Note that the segments
+    // are copied with the base class's (synchronous) implementation, so that
+    // they would not end up in this class's @c do_copy function again.
+    if (total <= m_config.sync_threshold) {
+        m_queue->wait_idle();
+        for (const segment& seg : segments) {
+            vecmem::copy::do_copy(seg.size, seg.from, seg.to, cptype);
+        }
+        return;
+    }
+
+    // Queue the batch, as a single operation. Calling this class's
+    // @c do_copy function from the queue's own worker would wait for the
+    // queue to become idle, which it never would.
+    m_queue->enqueue([this, segments, cptype]() {
+        for (const segment& seg : segments) {
+            vecmem::copy::do_copy(seg.size, seg.from, seg.to, cptype);
+        }
+    });
+    VECMEM_DEBUG_MSG(1,
+                     "Queued %lu asynchronous memory copies of %lu bytes",
+                     segments.size(), total);
+}
+
+void async_copy::do_copy_temporary(std::size_t size, const void* from_ptr,
+                                   void* to_ptr,
+                                   type::copy_type cptype) const {
+
+    // Small copies are performed synchronously anyway.
+    if (size <= m_config.sync_threshold) {
+        do_copy(size, from_ptr, to_ptr, cptype);
+        return;
+    }
+
+    // Take a snapshot of the source, which may not outlive this call.
+    auto source = std::make_shared<std::vector<char> >(
+        static_cast<const char*>(from_ptr),
+        static_cast<const char*>(from_ptr) + size);
+    m_queue->enqueue([this, size, source, to_ptr, cptype]() {
+        copy::do_copy(size, source->data(), to_ptr, cptype);
+    });
+    VECMEM_DEBUG_MSG(1,
+                     "Queued asynchronous memory copy of %lu bytes from a "
+                     "temporary buffer to %p",
+                     size, to_ptr);
+}
+
+void async_copy::do_memset(std::size_t size, void* ptr, int value) const {
+
+    // Perform small operations on the calling thread.
+    if (size <= m_config.sync_threshold) {
+        m_queue->wait_idle();
+        copy::do_memset(size, ptr, value);
+        return;
+    }
+
+    // Queue the operation.
+    m_queue->enqueue(
+        [this, size, ptr, value]() { copy::do_memset(size, ptr, value); });
+    VECMEM_DEBUG_MSG(2,
+                     "Queued setting %lu bytes to %i at %p asynchronously",
+                     size, value, ptr);
+}
+
+async_copy::event_type async_copy::create_event() const {
+
+    // Create an event, which would be completed by the queue once all
+    // previously issued operations have finished.
+    host_event event;
+    {
+        std::lock_guard<std::mutex> lock(m_queue->m_mutex);
+        if (m_queue->idle()) {
+            // If there is nothing to wait for, don't bother with the queue.
+            std::exception_ptr error = m_queue->take_error();
+            if (!error) {
+                return vecmem::copy::create_event();
+            }
+            event.complete(error);
+            return std::make_unique<host_event>(event);
+        }
+    }
+    details::async_copy_queue* queue = m_queue.get();
+    m_queue->enqueue([queue, event]() {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(queue->m_mutex);
+            error = queue->take_error();
+        }
+        event.complete(error);
+    });
+    return std::make_unique<host_event>(event);
+}
+
+}  // namespace vecmem::host
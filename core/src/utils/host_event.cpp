@@ -0,0 +1,117 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/host_event.hpp"
+
+// System include(s).
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vecmem {
+namespace details {
+
+/// State shared by the copies of a @c vecmem::host_event
+struct host_event_state {
+
+    /// Flag showing whether the event is complete
+    std::atomic<bool> m_complete{false};
+    /// The error that the event was completed with
+    std::exception_ptr m_error;
+    /// The functions to call once the event is complete
+    std::vector<std::function<void()> > m_callbacks;
+    /// Mutex protecting the members of the object
+    std::mutex m_mutex;
+    /// Condition variable used to signal the completion of the event
+    std::condition_variable m_cv;
+
+};  // struct host_event_state
+
+}  // namespace details
+
+host_event::host_event()
+    : m_state(std::make_shared<details::host_event_state>()) {}
+
+host_event::~host_event() {}
+
+void host_event::wait() {
+
+    // Wait for the event to complete, if it is not complete yet.
+    if (!m_state->m_complete.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(m_state->m_mutex);
+        m_state->m_cv.wait(lock, [this]() {
+            return m_state->m_complete.load(std::memory_order_relaxed);
+        });
+    }
+
+    // Re-throw the error, if there was one.
+    if (m_state->m_error) {
+        std::rethrow_exception(m_state->m_error);
+    }
+}
+
+bool host_event::is_ready() {
+
+    return m_state->m_complete.load(std::memory_order_acquire);
+}
+
+void host_event::complete() const {
+
+    complete(nullptr);
+}
+
+void host_event::complete(std::exception_ptr error) const {
+
+    // Mark the event as complete, taking the callbacks out of the state.
+    std::vector<std::function<void()> > callbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        if (m_state->m_complete.load(std::memory_order_relaxed)) {
+            return;
+        }
+        m_state->m_error = std::move(error);
+        m_state->m_complete.store(true, std::memory_order_release);
+        callbacks.swap(m_state->m_callbacks);
+    }
+    m_state->m_cv.notify_all();
+
+    // Run the callbacks, outside of the lock.
+    for (std::function<void()>& callback : callbacks) {
+        callback();
+    }
+}
+
+void host_event::then(std::function<void()> callback) const {
+
+    // A sanity check.
+    assert(callback);
+
+    // Store the callback if the event is not complete yet.
+    {
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        if (!m_state->m_complete.load(std::memory_order_relaxed)) {
+            m_state->m_callbacks.push_back(std::move(callback));
+            return;
+        }
+    }
+
+    // Call it right away if it is.
+    callback();
+}
+
+std::exception_ptr host_event::error() const {
+
+    std::lock_guard<std::mutex> lock(m_state->m_mutex);
+    return m_state->m_error;
+}
+
+}  // namespace vecmem
@@ -0,0 +1,306 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/instrumenting_copy.hpp"
+
+// System include(s).
+#include <cassert>
+#include <chrono>
+#include <utility>
+
+namespace {
+
+/// Clock used for measuring the latencies of the operations
+using clock_type = std::chrono::steady_clock;
+
+/// Get the nanoseconds elapsed since a given time point
+std::uint64_t elapsed(clock_type::time_point start) {
+
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            clock_type::now() - start)
+            .count());
+}
+
+}  // namespace
+
+namespace vecmem {
+
+std::size_t instrumenting_copy::histogram::bin(std::uint64_t value) {
+
+    std::size_t result = 0;
+    while ((value != 0) && (result < n_bins - 1)) {
+        value >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+void instrumenting_copy::histogram::fill(std::uint64_t value) {
+
+    ++(counts[bin(value)]);
+}
+
+auto instrumenting_copy::histogram::operator+=(const histogram& other)
+    -> histogram& {
+
+    for (std::size_t i = 0; i < n_bins; ++i) {
+        counts[i] += other.counts[i];
+    }
+    return *this;
+}
+
+auto instrumenting_copy::statistics::operator+=(const statistics& other)
+    -> statistics& {
+
+    calls += other.calls;
+    copies += other.copies;
+    bytes += other.bytes;
+    time += other.time;
+    sizes += other.sizes;
+    latencies += other.latencies;
+    return *this;
+}
+
+instrumenting_copy::scoped_tag::scoped_tag(instrumenting_copy& copy,
+                                           const std::string& tag)
+    : m_copy(copy), m_previous(copy.get_tag()) {
+
+    m_copy.set_tag(tag);
+}
+
+instrumenting_copy::scoped_tag::~scoped_tag() {
+
+    m_copy.set_tag(m_previous);
+}
+
+instrumenting_copy::instrumenting_copy(const copy& upstream)
+    : m_upstream(upstream) {
+
+    // Take over the high level settings of the upstream object.
+    set_staging(upstream.get_staging());
+    set_compression(upstream.get_compression());
+}
+
+instrumenting_copy::~instrumenting_copy() {}
+
+void instrumenting_copy::set_tag(const std::string& tag) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (tag.empty()) {
+        m_tags.erase(std::this_thread::get_id());
+    } else {
+        m_tags[std::this_thread::get_id()] = tag;
+    }
+}
+
+std::string instrumenting_copy::get_tag() const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_tags.find(std::this_thread::get_id());
+    return ((itr == m_tags.end()) ? std::string{} : itr->second);
+}
+
+std::vector<std::string> instrumenting_copy::get_tags() const {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string> result;
+    result.reserve(m_statistics.size());
+    for (const auto& stats : m_statistics) {
+        result.push_back(stats.first);
+    }
+    return result;
+}
+
+auto instrumenting_copy::get_statistics(type::copy_type cptype) const
+    -> statistics {
+
+    assert(static_cast<int>(cptype) >= 0);
+    assert(static_cast<int>(cptype) < static_cast<int>(type::count));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    statistics result;
+    for (const auto& stats : m_statistics) {
+        result += stats.second.copies[cptype];
+    }
+    return result;
+}
+
+auto instrumenting_copy::get_statistics(const std::string& tag,
+                                        type::copy_type cptype) const
+    -> statistics {
+
+    assert(static_cast<int>(cptype) >= 0);
+    assert(static_cast<int>(cptype) < static_cast<int>(type::count));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_statistics.find(tag);
+    if (itr == m_statistics.end()) {
+        return {};
+    }
+    return itr->second.copies[cptype];
+}
+
+auto instrumenting_copy::get_memset_statistics() const -> statistics {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    statistics result;
+    for (const auto& stats : m_statistics) {
+        result += stats.second.memsets;
+    }
+    return result;
+}
+
+auto instrumenting_copy::get_memset_statistics(const std::string& tag) const
+    -> statistics {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_statistics.find(tag);
+    if (itr == m_statistics.end()) {
+        return {};
+    }
+    return itr->second.memsets;
+}
+
+void instrumenting_copy::reset() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.clear();
+}
+
+void instrumenting_copy::add_pre_copy_hook(pre_copy_hook f) {
+
+    m_pre_copy_hooks.push_back(std::move(f));
+}
+
+void instrumenting_copy::add_post_copy_hook(post_copy_hook f) {
+
+    m_post_copy_hooks.push_back(std::move(f));
+}
+
+void instrumenting_copy::add_post_copy_batch_hook(post_copy_batch_hook f) {
+
+    m_post_copy_batch_hooks.push_back(std::move(f));
+}
+
+void instrumenting_copy::do_copy(std::size_t size, const void* from, void* to,
+                                 type::copy_type cptype) const {
+
+    record_copy(size, from, to, cptype, false);
+}
+
+void instrumenting_copy::do_copy_temporary(std::size_t size, const void* from,
+                                           void* to,
+                                           type::copy_type cptype) const {
+
+    record_copy(size, from, to, cptype, true);
+}
+
+void instrumenting_copy::record_copy(std::size_t size, const void* from,
+                                     void* to, type::copy_type cptype,
+                                     bool temporary) const {
+
+    // Run the pre-copy hooks.
+    for (const pre_copy_hook& f : m_pre_copy_hooks) {
+        f(size, from, to, cptype);
+    }
+
+    // Perform the copy, timing it.
+    const clock_type::time_point start = clock_type::now();
+    if (temporary) {
+        m_upstream.do_copy_temporary(size, from, to, cptype);
+    } else {
+        m_upstream.do_copy(size, from, to, cptype);
+    }
+    const std::uint64_t time = elapsed(start);
+
+    // Record it.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        statistics& stats = current().copies[cptype];
+        ++(stats.calls);
+        ++(stats.copies);
+        stats.bytes += size;
+        stats.time += time;
+        stats.sizes.fill(size);
+        stats.latencies.fill(time);
+    }
+
+    // Run the post-copy hooks.
+    for (const post_copy_hook& f : m_post_copy_hooks) {
+        f(size, from, to, cptype, time);
+    }
+}
+
+void instrumenting_copy::do_copy_batch(const std::vector<segment>& segments,
+                                       type::copy_type cptype) const {
+
+    // Run the pre-copy hooks.
+    for (const segment& seg : segments) {
+        for (const pre_copy_hook& f : m_pre_copy_hooks) {
+            f(seg.size, seg.from, seg.to, cptype);
+        }
+    }
+
+    // Perform the copies, timing them.
+    const clock_type::time_point start = clock_type::now();
+    m_upstream.do_copy_batch(segments, cptype);
+    const std::uint64_t time = elapsed(start);
+
+    // Record them.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        statistics& stats = current().copies[cptype];
+        ++(stats.calls);
+        stats.copies += segments.size();
+        for (const segment& seg : segments) {
+            stats.bytes += seg.size;
+            stats.sizes.fill(seg.size);
+        }
+        stats.time += time;
+        stats.latencies.fill(time);
+    }
+
+    // Run the post-copy batch hooks.
+    for (const post_copy_batch_hook& f : m_post_copy_batch_hooks) {
+        f(segments, cptype, time);
+    }
+}
+
+void instrumenting_copy::do_memset(std::size_t size, void* ptr,
+                                   int value) const {
+
+    // Perform the operation, timing it.
+    const clock_type::time_point start = clock_type::now();
+    m_upstream.do_memset(size, ptr, value);
+    const std::uint64_t time = elapsed(start);
+
+    // Record it.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    statistics& stats = current().memsets;
+    ++(stats.calls);
+    ++(stats.copies);
+    stats.bytes += size;
+    stats.time += time;
+    stats.sizes.fill(size);
+    stats.latencies.fill(time);
+}
+
+auto instrumenting_copy::create_event() const -> event_type {
+
+    return m_upstream.create_event();
+}
+
+auto instrumenting_copy::current() const -> tag_statistics& {
+
+    auto itr = m_tags.find(std::this_thread::get_id());
+    return m_statistics[(itr == m_tags.end()) ? std::string{} : itr->second];
+}
+
+}  // namespace vecmem
@@ -0,0 +1,243 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "non_temporal_memory.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <cstring>
+
+#ifdef VECMEM_HAVE_X86_STREAMING_STORES
+#include <immintrin.h>
+#endif  // VECMEM_HAVE_X86_STREAMING_STORES
+
+namespace {
+
+#ifdef VECMEM_HAVE_X86_STREAMING_STORES
+
+/// The number of bytes processed in one step by all of the kernels
+///
+/// It is the size of a cache line, so that every step would write one full
+/// line, allowing the CPU to combine the streaming stores most efficiently.
+///
+constexpr std::size_t block_size = 64;
+
+/// Operations smaller than this are performed with the regular functions
+constexpr std::size_t min_size = 4 * block_size;
+
+/// Type of the copy kernels, working on a whole number of aligned blocks
+typedef void (*copy_kernel)(char*, const char*, std::size_t);
+/// Type of the fill kernels, working on a whole number of aligned blocks
+typedef void (*fill_kernel)(char*, std::uint32_t, std::size_t);
+
+/// @name Copy kernels
+/// @{
+
+__attribute__((target("avx512f"))) void copy_avx512(char* to,
+                                                    const char* from,
+                                                    std::size_t size) {
+    for (std::size_t i = 0; i < size; i += block_size) {
+        _mm512_stream_si512(
+            reinterpret_cast<__m512i*>(to + i),
+            _mm512_loadu_si512(reinterpret_cast<const void*>(from + i)));
+    }
+}
+
+__attribute__((target("avx"))) void copy_avx(char* to, const char* from,
+                                             std::size_t size) {
+    for (std::size_t i = 0; i < size; i += block_size) {
+        const __m256i a =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i));
+        const __m256i b =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i + 32));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(to + i), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(to + i + 32), b);
+    }
+}
+
+__attribute__((target("sse2"))) void copy_sse2(char* to, const char* from,
+                                               std::size_t size) {
+    for (std::size_t i = 0; i < size; i += block_size) {
+        const __m128i a =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+        const __m128i b =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i + 16));
+        const __m128i c =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i + 32));
+        const __m128i d =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(to + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(to + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(to + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(to + i + 48), d);
+    }
+}
+
+/// @}
+
+/// @name Fill kernels
+/// @{
+
+__attribute__((target("avx512f"))) void fill_avx512(char* ptr,
+                                                    std::uint32_t pattern,
+                                                    std::size_t size) {
+    const __m512i value = _mm512_set1_epi32(static_cast<int>(pattern));
+    for (std::size_t i = 0; i < size; i += block_size) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr + i), value);
+    }
+}
+
+__attribute__((target("avx"))) void fill_avx(char* ptr, std::uint32_t pattern,
+                                             std::size_t size) {
+    const __m256i value = _mm256_set1_epi32(static_cast<int>(pattern));
+    for (std::size_t i = 0; i < size; i += block_size) {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr + i), value);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr + i + 32), value);
+    }
+}
+
+__attribute__((target("sse2"))) void fill_sse2(char* ptr,
+                                               std::uint32_t pattern,
+                                               std::size_t size) {
+    const __m128i value = _mm_set1_epi32(static_cast<int>(pattern));
+    for (std::size_t i = 0; i < size; i += block_size) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i), value);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i + 16), value);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i + 32), value);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i + 48), value);
+    }
+}
+
+/// @}
+
+/// The set of kernels selected for the current CPU
+struct kernels {
+    /// Name of the instruction set used
+    const char* m_isa = "none";
+    /// The copy kernel
+    copy_kernel m_copy = nullptr;
+    /// The fill kernel
+    fill_kernel m_fill = nullptr;
+};  // struct kernels
+
+/// Select the kernels to use, based on the capabilities of the CPU
+kernels select_kernels() {
+
+    kernels result;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        result.m_isa = "AVX-512";
+        result.m_copy = &copy_avx512;
+        result.m_fill = &fill_avx512;
+    } else if (__builtin_cpu_supports("avx")) {
+        result.m_isa = "AVX";
+        result.m_copy = &copy_avx;
+        result.m_fill = &fill_avx;
+    } else if (__builtin_cpu_supports("sse2")) {
+        result.m_isa = "SSE2";
+        result.m_copy = &copy_sse2;
+        result.m_fill = &fill_sse2;
+    }
+    return result;
+}
+
+/// Get the kernels to use on the current CPU
+const kernels& get_kernels() {
+
+    static const kernels result = select_kernels();
+    return result;
+}
+
+/// Get the number of bytes needed to reach the next block boundary
+std::size_t head_size(const void* ptr, std::size_t size) {
+
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(ptr) % block_size;
+    const std::size_t head =
+        (misalignment == 0 ? 0 : block_size - misalignment);
+    return (head < size ? head : size);
+}
+
+#endif  // VECMEM_HAVE_X86_STREAMING_STORES
+
+}  // namespace
+
+namespace vecmem {
+namespace details {
+
+void non_temporal_copy(void* to, const void* from, std::size_t size) {
+
+#ifdef VECMEM_HAVE_X86_STREAMING_STORES
+    const kernels& k = get_kernels();
+    if ((k.m_copy != nullptr) && (size >= min_size)) {
+
+        // Copy the bytes up to the first aligned target address normally.
+        char* to_ptr = static_cast<char*>(to);
+        const char* from_ptr = static_cast<const char*>(from);
+        const std::size_t head = head_size(to_ptr, size);
+        ::memcpy(to_ptr, from_ptr, head);
+
+        // Copy the aligned blocks with streaming stores.
+        const std::size_t body = ((size - head) / block_size) * block_size;
+        k.m_copy(to_ptr + head, from_ptr + head, body);
+
+        // Copy the remaining bytes normally.
+        ::memcpy(to_ptr + head + body, from_ptr + head + body,
+                 size - head - body);
+
+        // Make the streaming stores visible to all other threads.
+        _mm_sfence();
+        return;
+    }
+#endif  // VECMEM_HAVE_X86_STREAMING_STORES
+
+    // Fall back on a regular copy.
+    ::memcpy(to, from, size);
+}
+
+void non_temporal_fill(void* ptr, int value, std::size_t size) {
+
+#ifdef VECMEM_HAVE_X86_STREAMING_STORES
+    const kernels& k = get_kernels();
+    if ((k.m_fill != nullptr) && (size >= min_size)) {
+
+        // Fill the bytes up to the first aligned address normally.
+        char* char_ptr = static_cast<char*>(ptr);
+        const std::size_t head = head_size(char_ptr, size);
+        ::memset(char_ptr, value, head);
+
+        // Fill the aligned blocks with streaming stores.
+        const std::size_t body = ((size - head) / block_size) * block_size;
+        const std::uint32_t byte = static_cast<unsigned char>(value);
+        k.m_fill(char_ptr + head, byte * 0x01010101u, body);
+
+        // Fill the remaining bytes normally.
+        ::memset(char_ptr + head + body, value, size - head - body);
+
+        // Make the streaming stores visible to all other threads.
+        _mm_sfence();
+        return;
+    }
+#endif  // VECMEM_HAVE_X86_STREAMING_STORES
+
+    // Fall back on a regular fill.
+    ::memset(ptr, value, size);
+}
+
+const char* non_temporal_isa() {
+
+#ifdef VECMEM_HAVE_X86_STREAMING_STORES
+    return get_kernels().m_isa;
+#else
+    return "none";
+#endif  // VECMEM_HAVE_X86_STREAMING_STORES
+}
+
+}  // namespace details
+}  // namespace vecmem
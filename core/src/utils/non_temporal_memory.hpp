@@ -0,0 +1,34 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+namespace details {
+
+/// Copy memory without polluting the caches with the written data
+///
+/// On x86 CPUs the copy is done with non-temporal (streaming) stores, using
+/// the widest vector instructions available at runtime. On all other
+/// platforms it falls back to a simple @c ::memcpy call.
+///
+void non_temporal_copy(void* to, const void* from, std::size_t size);
+
+/// Fill memory without polluting the caches with the written data
+///
+/// Uses the same kernels as @c vecmem::details::non_temporal_copy.
+///
+void non_temporal_fill(void* ptr, int value, std::size_t size);
+
+/// Get the name of the instruction set used by the non-temporal kernels
+const char* non_temporal_isa();
+
+}  // namespace details
+}  // namespace vecmem
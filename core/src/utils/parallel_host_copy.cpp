@@ -0,0 +1,242 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/parallel_host_copy.hpp"
+
+#include "non_temporal_memory.hpp"
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/// Alignment (in bytes) used for the boundaries of the per-thread chunks
+///
+/// Using cache line boundaries makes sure that no two threads would write to
+/// the same cache line.
+///
+constexpr std::size_t chunk_alignment = 64;
+
+/// Get the (aligned) size of the chunks to split an operation into
+std::size_t chunk_size(std::size_t size, std::size_t n_chunks) {
+
+    const std::size_t chunk = (size + n_chunks - 1) / n_chunks;
+    return ((chunk + chunk_alignment - 1) / chunk_alignment) * chunk_alignment;
+}
+
+/// Copy a block of memory, with or without non-temporal stores
+void copy_bytes(void* to, const void* from, std::size_t size,
+                bool non_temporal) {
+
+    if (non_temporal) {
+        vecmem::details::non_temporal_copy(to, from, size);
+    } else {
+        ::memcpy(to, from, size);
+    }
+}
+
+/// Fill a block of memory, with or without non-temporal stores
+void fill_bytes(void* ptr, int value, std::size_t size, bool non_temporal) {
+
+    if (non_temporal) {
+        vecmem::details::non_temporal_fill(ptr, value, size);
+    } else {
+        ::memset(ptr, value, size);
+    }
+}
+
+}  // namespace
+
+namespace vecmem {
+
+parallel_host_copy::parallel_host_copy(std::size_t n_threads)
+    : parallel_host_copy(n_threads, config{}) {}
+
+parallel_host_copy::parallel_host_copy(std::size_t n_threads,
+                                       const config& cfg)
+    : m_owned_pool(std::make_unique<thread_pool>(n_threads)),
+      m_pool(*m_owned_pool),
+      m_config(cfg) {}
+
+parallel_host_copy::parallel_host_copy(thread_pool& pool)
+    : parallel_host_copy(pool, config{}) {}
+
+parallel_host_copy::parallel_host_copy(thread_pool& pool, const config& cfg)
+    : m_owned_pool(), m_pool(pool), m_config(cfg) {}
+
+parallel_host_copy::~parallel_host_copy() {}
+
+auto parallel_host_copy::get_config() const -> const config& {
+
+    return m_config;
+}
+
+void parallel_host_copy::do_copy(std::size_t size, const void* from_ptr,
+                                 void* to_ptr, type::copy_type cptype) const {
+
+    // Decide how many pieces to split the copy into, and how to copy them.
+    const std::size_t n = n_chunks(size);
+    const bool non_temporal = (size >= m_config.non_temporal_threshold);
+
+    // Perform small copies on the calling thread.
+    if ((n < 2) && (!non_temporal)) {
+        copy::do_copy(size, from_ptr, to_ptr, cptype);
+        return;
+    }
+    if (n < 2) {
+        copy_bytes(to_ptr, from_ptr, size, non_temporal);
+        VECMEM_DEBUG_MSG(1,
+                         "Performed non-temporal (%s) memory copy of %lu "
+                         "bytes from %p to %p",
+                         details::non_temporal_isa(), size, from_ptr, to_ptr);
+        return;
+    }
+
+    // Copy contiguous, cache line aligned chunks of the memory in parallel.
+    const std::size_t chunk = chunk_size(size, n);
+    m_pool.parallel_for(n, [&](std::size_t i) {
+        const std::size_t begin = i * chunk;
+        if (begin >= size) {
+            return;
+        }
+        copy_bytes(static_cast<char*>(to_ptr) + begin,
+                   static_cast<const char*>(from_ptr) + begin,
+                   std::min(chunk, size - begin), non_temporal);
+    });
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(1,
+                     "Performed parallel%s memory copy of %lu bytes from %p "
+                     "to %p in %lu chunks",
+                     (non_temporal ? " non-temporal" : ""), size, from_ptr,
+                     to_ptr, n);
+}
+
+void parallel_host_copy::do_copy_batch(const std::vector<segment>& segments,
+                                       type::copy_type cptype) const {
+
+    // Calculate the total amount of data to copy.
+    std::size_t total = 0;
+    for (const segment& seg : segments) {
+        total += seg.size;
+    }
+
+    // Decide how many pieces to split the copies into, and how to copy them.
+    const std::size_t n = n_chunks(total);
+    const bool non_temporal = (total >= m_config.non_temporal_threshold);
+
+    // Let the base class handle small batches.
+    if ((n < 2) && (!non_temporal)) {
+        copy::do_copy_batch(segments, cptype);
+        return;
+    }
+    if (n < 2) {
+        for (const segment& seg : segments) {
+            copy_bytes(seg.to, seg.from, seg.size, non_temporal);
+        }
+        VECMEM_DEBUG_MSG(1,
+                         "Performed %lu non-temporal (%s) memory copies of "
+                         "%lu bytes",
+                         segments.size(), details::non_temporal_isa(), total);
+        return;
+    }
+
+    // Distribute the segments into buckets of roughly the same size, splitting
+    // up the segments that would not fit into a single bucket.
+    const std::size_t target = (total + n - 1) / n;
+    std::vector<std::vector<segment> > buckets(1);
+    std::size_t fill = 0;
+    for (const segment& seg : segments) {
+        std::size_t offset = 0;
+        while (offset < seg.size) {
+            if (fill == target) {
+                buckets.emplace_back();
+                fill = 0;
+            }
+            const std::size_t piece =
+                std::min(seg.size - offset, target - fill);
+            buckets.back().push_back(
+                {piece, static_cast<const char*>(seg.from) + offset,
+                 static_cast<char*>(seg.to) + offset});
+            offset += piece;
+            fill += piece;
+        }
+    }
+
+    // Process the buckets in parallel.
+    m_pool.parallel_for(buckets.size(), [&](std::size_t i) {
+        for (const segment& seg : buckets[i]) {
+            copy_bytes(seg.to, seg.from, seg.size, non_temporal);
+        }
+    });
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(1,
+                     "Performed %lu parallel%s memory copies of %lu bytes in "
+                     "%lu chunks",
+                     segments.size(), (non_temporal ? " non-temporal" : ""),
+                     total, buckets.size());
+}
+
+void parallel_host_copy::do_memset(std::size_t size, void* ptr,
+                                   int value) const {
+
+    // Decide how many pieces to split the operation into, and how to perform
+    // them.
+    const std::size_t n = n_chunks(size);
+    const bool non_temporal = (size >= m_config.non_temporal_threshold);
+
+    // Perform small operations on the calling thread.
+    if ((n < 2) && (!non_temporal)) {
+        copy::do_memset(size, ptr, value);
+        return;
+    }
+    if (n < 2) {
+        fill_bytes(ptr, value, size, non_temporal);
+        VECMEM_DEBUG_MSG(2,
+                         "Set %lu bytes to %i at %p with non-temporal (%s) "
+                         "stores",
+                         size, value, ptr, details::non_temporal_isa());
+        return;
+    }
+
+    // Fill contiguous, cache line aligned chunks of the memory in parallel.
+    const std::size_t chunk = chunk_size(size, n);
+    m_pool.parallel_for(n, [&](std::size_t i) {
+        const std::size_t begin = i * chunk;
+        if (begin >= size) {
+            return;
+        }
+        fill_bytes(static_cast<char*>(ptr) + begin, value,
+                   std::min(chunk, size - begin), non_temporal);
+    });
+
+    // Let the user know what happened.
+    VECMEM_DEBUG_MSG(2, "Set %lu bytes to %i at %p in %lu parallel%s chunks",
+                     size, value, ptr, n,
+                     (non_temporal ? " non-temporal" : ""));
+}
+
+std::size_t parallel_host_copy::n_chunks(std::size_t size) const {
+
+    // Small operations are not split up.
+    if (size < m_config.parallel_threshold) {
+        return 1;
+    }
+
+    // Give every thread (including the calling one) at least the minimum
+    // amount of work.
+    const std::size_t max_chunks =
+        size / std::max(m_config.min_chunk_size, chunk_alignment);
+    return std::max<std::size_t>(std::min(max_chunks, m_pool.size() + 1), 1);
+}
+
+}  // namespace vecmem
@@ -0,0 +1,348 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/shuffle_lz_codec.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// The minimal length of a back-reference
+constexpr std::size_t min_match = 4;
+/// The maximal distance of a back-reference
+constexpr std::size_t max_offset = 65535;
+/// The number of bits used in the hash table lookup
+constexpr unsigned int hash_bits = 13;
+
+/// Round the chunk size down to a multiple of the element size
+std::size_t round_chunk_size(std::size_t chunk_size, std::size_t element_size) {
+
+    if (element_size <= 1) {
+        return chunk_size;
+    }
+    return std::max(chunk_size - chunk_size % element_size, element_size);
+}
+
+/// Read 4 bytes from an arbitrary address
+std::uint32_t read32(const unsigned char* ptr) {
+
+    std::uint32_t result;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+/// Hash of a 4-byte sequence
+std::uint32_t hash(std::uint32_t sequence) {
+
+    return (sequence * 2654435761u) >> (32 - hash_bits);
+}
+
+/// Helper writing the compressed stream, with bounds checking
+class writer {
+
+public:
+    /// Constructor with the output memory block
+    writer(unsigned char* out, std::size_t capacity)
+        : m_ptr(out), m_begin(out), m_end(out + capacity) {}
+
+    /// Write one byte
+    bool put(unsigned char value) {
+        if (m_ptr == m_end) {
+            return false;
+        }
+        *(m_ptr++) = value;
+        return true;
+    }
+    /// Write the extension bytes of a length field
+    bool put_length(std::size_t length) {
+        for (; length >= 255; length -= 255) {
+            if (!put(255)) {
+                return false;
+            }
+        }
+        return put(static_cast<unsigned char>(length));
+    }
+    /// Write a block of bytes
+    bool put(const unsigned char* data, std::size_t size) {
+        if (static_cast<std::size_t>(m_end - m_ptr) < size) {
+            return false;
+        }
+        std::memcpy(m_ptr, data, size);
+        m_ptr += size;
+        return true;
+    }
+    /// Get the number of bytes written
+    std::size_t size() const {
+        return static_cast<std::size_t>(m_ptr - m_begin);
+    }
+
+private:
+    /// The current position
+    unsigned char* m_ptr;
+    /// The beginning of the output
+    unsigned char* m_begin;
+    /// The end of the output
+    unsigned char* m_end;
+
+};  // class writer
+
+/// Write one sequence of literals, with an optional back-reference
+bool write_sequence(writer& out, const unsigned char* literals,
+                    std::size_t n_literals, std::size_t offset,
+                    std::size_t match) {
+
+    // Construct the token.
+    const std::size_t match_code = ((match == 0) ? 0 : match - min_match);
+    const unsigned char token = static_cast<unsigned char>(
+        (std::min<std::size_t>(n_literals, 15) << 4) |
+        std::min<std::size_t>(match_code, 15));
+    if (!out.put(token)) {
+        return false;
+    }
+
+    // Write the literals.
+    if ((n_literals >= 15) && (!out.put_length(n_literals - 15))) {
+        return false;
+    }
+    if (!out.put(literals, n_literals)) {
+        return false;
+    }
+
+    // Write the back-reference.
+    if (match == 0) {
+        return true;
+    }
+    if (!(out.put(static_cast<unsigned char>(offset & 0xff)) &&
+          out.put(static_cast<unsigned char>(offset >> 8)))) {
+        return false;
+    }
+    if (match_code >= 15) {
+        return out.put_length(match_code - 15);
+    }
+    return true;
+}
+
+/// Compress a memory block with LZ77
+std::size_t lz_compress(const unsigned char* in, std::size_t size,
+                        unsigned char* out, std::size_t capacity) {
+
+    // Don't bother with very small blocks.
+    if (size < 2 * min_match) {
+        return 0;
+    }
+
+    // Set up the compression.
+    writer output(out, capacity);
+    std::vector<std::uint32_t> table(std::size_t(1) << hash_bits, 0);
+    std::size_t pos = 0, anchor = 0;
+    const std::size_t last = size - min_match;
+
+    // Look for matches.
+    while (pos <= last) {
+        const std::uint32_t sequence = read32(in + pos);
+        std::uint32_t& entry = table[hash(sequence)];
+        const std::size_t candidate = entry;
+        entry = static_cast<std::uint32_t>(pos);
+        if ((candidate < pos) && (pos - candidate <= max_offset) &&
+            (read32(in + candidate) == sequence)) {
+            // Extend the match as much as possible.
+            std::size_t match = min_match;
+            while ((pos + match < size) &&
+                   (in[candidate + match] == in[pos + match])) {
+                ++match;
+            }
+            if (!write_sequence(output, in + anchor, pos - anchor,
+                                pos - candidate, match)) {
+                return 0;
+            }
+            pos += match;
+            anchor = pos;
+        } else {
+            // Move on faster when no matches are found for a while.
+            pos += 1 + ((pos - anchor) >> 6);
+        }
+    }
+
+    // Write the remaining literals.
+    if (!write_sequence(output, in + anchor, size - anchor, 0, 0)) {
+        return 0;
+    }
+    return output.size();
+}
+
+/// Read the extension bytes of a length field
+std::size_t read_length(const unsigned char*& ptr, const unsigned char* end) {
+
+    std::size_t result = 0;
+    while (true) {
+        if (ptr == end) {
+            throw std::runtime_error("Truncated LZ77 stream");
+        }
+        const unsigned char value = *(ptr++);
+        result += value;
+        if (value != 255) {
+            return result;
+        }
+    }
+}
+
+/// Decompress a memory block compressed with LZ77
+void lz_decompress(const unsigned char* in, std::size_t compressed_size,
+                   unsigned char* out, std::size_t size) {
+
+    const unsigned char* ptr = in;
+    const unsigned char* end = in + compressed_size;
+    std::size_t pos = 0;
+    while (true) {
+
+        // Read the token.
+        if (ptr == end) {
+            throw std::runtime_error("Truncated LZ77 stream");
+        }
+        const unsigned char token = *(ptr++);
+
+        // Copy the literals.
+        std::size_t n_literals = (token >> 4);
+        if (n_literals == 15) {
+            n_literals += read_length(ptr, end);
+        }
+        if ((static_cast<std::size_t>(end - ptr) < n_literals) ||
+            (size - pos < n_literals)) {
+            throw std::runtime_error("Corrupt LZ77 stream");
+        }
+        std::memcpy(out + pos, ptr, n_literals);
+        ptr += n_literals;
+        pos += n_literals;
+
+        // Check if we reached the end.
+        if (pos == size) {
+            if (ptr != end) {
+                throw std::runtime_error("Corrupt LZ77 stream");
+            }
+            return;
+        }
+
+        // Copy the back-reference.
+        if (end - ptr < 2) {
+            throw std::runtime_error("Truncated LZ77 stream");
+        }
+        const std::size_t offset =
+            static_cast<std::size_t>(ptr[0]) |
+            (static_cast<std::size_t>(ptr[1]) << 8);
+        ptr += 2;
+        std::size_t match = (token & 0xf);
+        if (match == 15) {
+            match += read_length(ptr, end);
+        }
+        match += min_match;
+        if ((offset == 0) || (offset > pos) || (size - pos < match)) {
+            throw std::runtime_error("Corrupt LZ77 stream");
+        }
+        // Overlapping back-references repeat a pattern of "offset" bytes.
+        // Copy it in non-overlapping pieces of growing size.
+        const unsigned char* source = out + pos - offset;
+        std::size_t distance = offset;
+        for (std::size_t left = match; left > 0;) {
+            const std::size_t n = std::min(distance, left);
+            std::memcpy(out + pos, source, n);
+            pos += n;
+            left -= n;
+            distance *= 2;
+        }
+    }
+}
+
+}  // namespace
+
+namespace vecmem {
+
+shuffle_lz_codec::shuffle_lz_codec(std::size_t element_size,
+                                   std::size_t chunk_size)
+    : codec(round_chunk_size(chunk_size, element_size)),
+      m_element_size(element_size) {
+
+    if (m_element_size == 0) {
+        throw std::invalid_argument("The element size must not be zero");
+    }
+}
+
+std::size_t shuffle_lz_codec::element_size() const {
+
+    return m_element_size;
+}
+
+std::size_t shuffle_lz_codec::do_max_compressed_size(std::size_t size) const {
+
+    return size + size / 255 + 16;
+}
+
+std::size_t shuffle_lz_codec::do_compress(const void* in, std::size_t size,
+                                          void* out,
+                                          std::size_t capacity) const {
+
+    const unsigned char* input = static_cast<const unsigned char*>(in);
+    unsigned char* output = static_cast<unsigned char*>(out);
+
+    // Compress the data directly, if no shuffling is needed.
+    const std::size_t n_elements = size / m_element_size;
+    if ((m_element_size == 1) || (n_elements < 2)) {
+        return lz_compress(input, size, output, capacity);
+    }
+
+    // Shuffle the bytes of the elements. Trailing bytes not making up a full
+    // element are left in place.
+    std::vector<unsigned char> shuffled(size);
+    for (std::size_t i = 0; i < n_elements; ++i) {
+        for (std::size_t j = 0; j < m_element_size; ++j) {
+            shuffled[j * n_elements + i] = input[i * m_element_size + j];
+        }
+    }
+    const std::size_t n_shuffled = n_elements * m_element_size;
+    std::memcpy(shuffled.data() + n_shuffled, input + n_shuffled,
+                size - n_shuffled);
+
+    // Compress the shuffled data.
+    return lz_compress(shuffled.data(), size, output, capacity);
+}
+
+void shuffle_lz_codec::do_decompress(const void* in,
+                                     std::size_t compressed_size, void* out,
+                                     std::size_t size) const {
+
+    const unsigned char* input = static_cast<const unsigned char*>(in);
+    unsigned char* output = static_cast<unsigned char*>(out);
+
+    // Decompress the data directly, if no shuffling was done.
+    const std::size_t n_elements = size / m_element_size;
+    if ((m_element_size == 1) || (n_elements < 2)) {
+        lz_decompress(input, compressed_size, output, size);
+        return;
+    }
+
+    // Decompress the shuffled data.
+    std::vector<unsigned char> shuffled(size);
+    lz_decompress(input, compressed_size, shuffled.data(), size);
+
+    // Un-shuffle the bytes of the elements.
+    for (std::size_t i = 0; i < n_elements; ++i) {
+        for (std::size_t j = 0; j < m_element_size; ++j) {
+            output[i * m_element_size + j] = shuffled[j * n_elements + i];
+        }
+    }
+    const std::size_t n_shuffled = n_elements * m_element_size;
+    std::memcpy(output + n_shuffled, shuffled.data() + n_shuffled,
+                size - n_shuffled);
+}
+
+}  // namespace vecmem
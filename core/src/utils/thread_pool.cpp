@@ -0,0 +1,207 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/thread_pool.hpp"
+
+#include "vecmem/utils/debug.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// State shared between the threads taking part in a @c parallel_for call
+struct parallel_for_state {
+
+    /// Constructor with all necessary parameters
+    parallel_for_state(std::size_t n_tasks,
+                       const std::function<void(std::size_t)>& func)
+        : m_n_tasks(n_tasks), m_func(func) {}
+
+    /// Process indices until there are none left
+    void run() {
+
+        std::size_t i = 0;
+        while ((i = m_next.fetch_add(1)) < m_n_tasks) {
+            // Execute the function, remembering the first exception that it
+            // may throw.
+            try {
+                m_func(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_exception) {
+                    m_exception = std::current_exception();
+                }
+            }
+            // Signal the calling thread once all indices are done.
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (++m_done == m_n_tasks) {
+                m_cv.notify_all();
+            }
+        }
+    }
+
+    /// The total number of indices to process
+    const std::size_t m_n_tasks;
+    /// The function to execute
+    ///
+    /// It is only accessed while the calling thread is waiting for the
+    /// indices to be processed, so it does not need to be copied.
+    ///
+    const std::function<void(std::size_t)>& m_func;
+    /// The next index to process
+    std::atomic<std::size_t> m_next{0};
+    /// The number of processed indices
+    std::size_t m_done = 0;
+    /// The first exception thrown by the function
+    std::exception_ptr m_exception;
+    /// Mutex protecting the members of the object
+    std::mutex m_mutex;
+    /// Condition variable used to signal the end of the processing
+    std::condition_variable m_cv;
+
+};  // struct parallel_for_state
+
+}  // namespace
+
+namespace vecmem {
+namespace details {
+
+/// Implementation of @c vecmem::thread_pool
+struct thread_pool_impl {
+
+    /// Function executed by the worker threads
+    void work() {
+
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+                if (m_tasks.empty()) {
+                    // This only happens when the pool is being stopped.
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    /// The worker threads
+    std::vector<std::thread> m_threads;
+    /// The tasks waiting for execution
+    std::deque<std::function<void()> > m_tasks;
+    /// Flag telling the workers to stop
+    bool m_stop = false;
+    /// Mutex protecting the task queue
+    std::mutex m_mutex;
+    /// Condition variable used to wake up the workers
+    std::condition_variable m_cv;
+
+};  // struct thread_pool_impl
+
+}  // namespace details
+
+thread_pool::thread_pool(std::size_t n_threads)
+    : m_impl(std::make_unique<details::thread_pool_impl>()) {
+
+    // Figure out how many threads to start.
+    if (n_threads == 0) {
+        n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // Start the threads.
+    m_impl->m_threads.reserve(n_threads);
+    for (std::size_t i = 0; i < n_threads; ++i) {
+        m_impl->m_threads.emplace_back([this]() { m_impl->work(); });
+    }
+    VECMEM_DEBUG_MSG(2, "Started a thread pool with %lu thread(s)", n_threads);
+}
+
+thread_pool::~thread_pool() {
+
+    // Tell the threads to stop, once they processed all the tasks.
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        m_impl->m_stop = true;
+    }
+    m_impl->m_cv.notify_all();
+
+    // Wait for them to stop.
+    for (std::thread& thread : m_impl->m_threads) {
+        thread.join();
+    }
+}
+
+std::size_t thread_pool::size() const {
+
+    return m_impl->m_threads.size();
+}
+
+void thread_pool::submit(std::function<void()> task) {
+
+    // A sanity check.
+    assert(task);
+
+    // Add the task to the queue, and wake up one of the workers.
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        m_impl->m_tasks.push_back(std::move(task));
+    }
+    m_impl->m_cv.notify_one();
+}
+
+void thread_pool::parallel_for(std::size_t n_tasks,
+                               const std::function<void(std::size_t)>& func) {
+
+    // Check if anything needs to be done.
+    if (n_tasks == 0) {
+        return;
+    }
+    // Handle the trivial case without any overhead.
+    if (n_tasks == 1) {
+        func(0);
+        return;
+    }
+
+    // Set up the shared state of the processing.
+    auto state = std::make_shared<parallel_for_state>(n_tasks, func);
+
+    // Ask the workers to help with the processing.
+    const std::size_t n_helpers = std::min(size(), n_tasks - 1);
+    for (std::size_t i = 0; i < n_helpers; ++i) {
+        submit([state]() { state->run(); });
+    }
+
+    // Take part in the processing.
+    state->run();
+
+    // Wait for all indices to be processed.
+    std::unique_lock<std::mutex> lock(state->m_mutex);
+    state->m_cv.wait(lock, [&state]() {
+        return state->m_done == state->m_n_tasks;
+    });
+
+    // Re-throw the first exception, if there was one.
+    if (state->m_exception) {
+        std::rethrow_exception(state->m_exception);
+    }
+}
+
+}  // namespace vecmem
@@ -0,0 +1,251 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/trace_writer.hpp"
+
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+#include "vecmem/utils/instrumenting_copy.hpp"
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <ostream>
+#include <stdexcept>
+
+namespace {
+
+/// Names of the copy types, as they appear in the trace
+const char* const copy_type_names[vecmem::copy::type::count] = {
+    "host_to_device", "device_to_host", "host_to_host", "device_to_device",
+    "unknown"};
+
+/// Get the current time of the steady clock, in nanoseconds
+vecmem::trace_writer::time_type clock_now() {
+
+    return static_cast<vecmem::trace_writer::time_type>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+/// Get a small, unique identifier for the current thread
+unsigned int thread_index() {
+
+    static std::atomic<unsigned int> next{0};
+    thread_local const unsigned int index = next++;
+    return index;
+}
+
+/// Write a string into a JSON document, escaping it as necessary
+void write_escaped(std::ostream& out, const char* str) {
+
+    // Write the string in runs of characters that need no escaping.
+    const char* run = str;
+    for (const char* c = str; *c != '\0'; ++c) {
+        const unsigned char uc = static_cast<unsigned char>(*c);
+        if ((uc >= 0x20) && (uc != '"') && (uc != '\\')) {
+            continue;
+        }
+        out.write(run, c - run);
+        if ((uc == '"') || (uc == '\\')) {
+            const char escaped[2] = {'\\', *c};
+            out.write(escaped, 2);
+        } else {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x",
+                          static_cast<unsigned int>(uc));
+            out.write(escaped, 6);
+        }
+        run = c + 1;
+    }
+    out << run;
+}
+
+/// Append formatted text to a fixed size buffer
+///
+/// @throws std::runtime_error If the text does not fit into the buffer
+///
+template <std::size_t SIZE, typename... ARGS>
+void append(char (&buffer)[SIZE], std::size_t& length, const char* format,
+            ARGS... args) {
+
+    const int result =
+        std::snprintf(buffer + length, SIZE - length, format, args...);
+    if ((result < 0) || (static_cast<std::size_t>(result) >= SIZE - length)) {
+        throw std::runtime_error("Could not format a trace record");
+    }
+    length += static_cast<std::size_t>(result);
+}
+
+/// Start times of the allocations in progress on the current thread
+///
+/// A stack is needed, since allocations may be nested. (Instrumented memory
+/// resources may be used as upstream resources of other instrumented
+/// resources.)
+///
+thread_local std::vector<vecmem::trace_writer::time_type> allocation_starts;
+
+}  // namespace
+
+namespace vecmem {
+
+trace_writer::scoped_event::scoped_event(trace_writer& writer,
+                                         const char* name,
+                                         const char* category)
+    : m_writer(writer),
+      m_name(name),
+      m_category(category),
+      m_start(writer.now()) {}
+
+trace_writer::scoped_event::~scoped_event() {
+
+    m_writer.complete(m_name, m_category, m_start, m_writer.now() - m_start);
+}
+
+trace_writer::trace_writer(const std::string& filename,
+                           std::size_t buffer_size)
+    : m_file(filename),
+      m_stream(m_file),
+      m_buffer_size(buffer_size),
+      m_start(clock_now()) {
+
+    if (!m_file) {
+        throw std::runtime_error("Could not open trace file: " + filename);
+    }
+    m_records.reserve(m_buffer_size);
+    m_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+}
+
+trace_writer::trace_writer(std::ostream& stream, std::size_t buffer_size)
+    : m_file(),
+      m_stream(stream),
+      m_buffer_size(buffer_size),
+      m_start(clock_now()) {
+
+    m_records.reserve(m_buffer_size);
+    m_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+}
+
+trace_writer::~trace_writer() {
+
+    // Write out all remaining records, and close the JSON document.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    write_records();
+    m_stream << "\n]}\n";
+    m_stream.flush();
+}
+
+auto trace_writer::now() const -> time_type {
+
+    return clock_now() - m_start;
+}
+
+void trace_writer::complete(const char* name, const char* category,
+                            time_type start, time_type duration,
+                            std::size_t bytes) {
+
+    add({name, category, 'X', thread_index(), start, duration, bytes});
+}
+
+void trace_writer::instant(const char* name, const char* category,
+                           std::size_t bytes) {
+
+    add({name, category, 'i', thread_index(), now(), 0, bytes});
+}
+
+void trace_writer::attach(instrumenting_memory_resource& resource) {
+
+    resource.add_pre_allocate_hook([this](std::size_t, std::size_t) {
+        allocation_starts.push_back(now());
+    });
+    resource.add_post_allocate_hook(
+        [this](std::size_t size, std::size_t, void* ptr) {
+            const time_type start = allocation_starts.back();
+            allocation_starts.pop_back();
+            complete((ptr != nullptr ? "allocate" : "allocate (failed)"),
+                     "memory", start, now() - start, size);
+        });
+    resource.add_pre_deallocate_hook([this](void*, std::size_t size,
+                                            std::size_t) {
+        instant("deallocate", "memory", size);
+    });
+}
+
+void trace_writer::attach(instrumenting_copy& copy) {
+
+    copy.add_post_copy_hook([this](std::size_t size, const void*, void*,
+                                   copy::type::copy_type cptype,
+                                   std::uint64_t duration) {
+        const time_type end = now();
+        complete(copy_type_names[cptype], "copy",
+                 (end > duration ? end - duration : 0), duration, size);
+    });
+    copy.add_post_copy_batch_hook(
+        [this](const std::vector<copy::segment>& segments,
+               copy::type::copy_type cptype, std::uint64_t duration) {
+            std::size_t size = 0;
+            for (const copy::segment& seg : segments) {
+                size += seg.size;
+            }
+            const time_type end = now();
+            complete(copy_type_names[cptype], "copy",
+                     (end > duration ? end - duration : 0), duration, size);
+        });
+}
+
+void trace_writer::flush() {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    write_records();
+    m_stream.flush();
+}
+
+void trace_writer::add(const record& r) {
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.push_back(r);
+    if (m_records.size() >= m_buffer_size) {
+        write_records();
+    }
+}
+
+void trace_writer::write_records() {
+
+    // Format the records one by one. The names and categories are escaped
+    // into the stream directly, while the numbers are formatted with
+    // snprintf, which is a lot faster than formatting them with the stream
+    // itself. (Their formatted length is bounded, so a small buffer is
+    // enough for them.)
+    char buffer[256];
+    for (const record& r : m_records) {
+        m_stream << (m_first ? "" : ",") << "\n{\"name\":\"";
+        write_escaped(m_stream, r.name);
+        m_stream << "\",\"cat\":\"";
+        write_escaped(m_stream, r.category);
+        std::size_t length = 0;
+        append(buffer, length,
+               "\",\"ph\":\"%c\",\"pid\":0,\"tid\":%u,\"ts\":%" PRIu64
+               ".%03" PRIu64,
+               r.phase, r.thread, r.start / 1000, r.start % 1000);
+        if (r.phase == 'X') {
+            append(buffer, length, ",\"dur\":%" PRIu64 ".%03" PRIu64,
+                   r.duration / 1000, r.duration % 1000);
+        } else {
+            append(buffer, length, ",\"s\":\"%c\"", 't');
+        }
+        append(buffer, length, ",\"args\":{\"bytes\":%zu}}", r.bytes);
+        m_stream.write(buffer, static_cast<std::streamsize>(length));
+        m_first = false;
+    }
+    m_records.clear();
+}
+
+}  // namespace vecmem
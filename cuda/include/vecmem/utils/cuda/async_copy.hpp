@@ -10,8 +10,19 @@
 // VecMem include(s).
 #include "vecmem/utils/copy.hpp"
 #include "vecmem/utils/cuda/stream_wrapper.hpp"
+#include "vecmem/utils/event_pool.hpp"
 #include "vecmem/vecmem_cuda_export.hpp"
 
+// System include(s).
+#include <memory>
+
+// Disable the warning(s) about inheriting from/using standard library types
+// with an exported class.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif  // MSVC
+
 namespace vecmem::cuda {
 
 /// Specialisation of @c vecmem::copy for CUDA
@@ -24,6 +35,9 @@ namespace vecmem::cuda {
 /// right order, and they would finish before an operation that needs them
 /// is executed.
 ///
+/// The CUDA events used for synchronization are recycled between the copy
+/// operations, instead of being created and destroyed for every one of them.
+///
 class VECMEM_CUDA_EXPORT async_copy : public vecmem::copy {
 
 public:
@@ -43,7 +57,14 @@ protected:
 private:
     /// The stream that the copies are performed on
     stream_wrapper m_stream;
+    /// Pool of the CUDA events created by the object
+    std::shared_ptr<event_pool> m_events;
 
 };  // class async_copy
 
 }  // namespace vecmem::cuda
+
+// Re-enable the warning(s).
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
@@ -18,7 +18,9 @@
 
 // System include(s).
 #include <cassert>
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace {
 
@@ -34,6 +36,15 @@ struct cuda_event : public vecmem::abstract_event {
     virtual void wait() override {
         VECMEM_CUDA_ERROR_CHECK(cudaEventSynchronize(m_event));
     }
+    /// Query the state of the underlying CUDA event
+    virtual bool is_ready() override {
+        const cudaError_t status = cudaEventQuery(m_event);
+        if (status == cudaErrorNotReady) {
+            return false;
+        }
+        VECMEM_CUDA_ERROR_CHECK(status);
+        return true;
+    }
 
     /// The CUDA event wrapped by this struct
     cudaEvent_t m_event;
@@ -55,7 +66,8 @@ static const std::string copy_type_printer[copy::type::count] = {
     "host to device", "device to host", "host to host", "device to device",
     "unknown"};
 
-async_copy::async_copy(const stream_wrapper& stream) : m_stream(stream) {}
+async_copy::async_copy(const stream_wrapper& stream)
+    : m_stream(stream), m_events(std::make_shared<event_pool>()) {}
 
 void async_copy::do_copy(std::size_t size, const void* from_ptr, void* to_ptr,
                          type::copy_type cptype) const {
@@ -107,20 +119,24 @@ void async_copy::do_memset(std::size_t size, void* ptr, int value) const {
 
 async_copy::event_type async_copy::create_event() const {
 
-    // Create a CUDA event.
-    cudaEvent_t cudaEvent = nullptr;
-    VECMEM_CUDA_ERROR_CHECK(cudaEventCreate(&cudaEvent));
-
-    // Create a smart pointer around it to make memory management a little
-    // safer.
-    auto event = std::make_unique<::cuda_event>(cudaEvent);
+    // Re-use a previously created CUDA event if possible.
+    std::unique_ptr<abstract_event> event = m_events->acquire();
+    if (!event) {
+        // Create a new CUDA event. Without timing information, as that
+        // makes recording and synchronizing on it cheaper.
+        cudaEvent_t cudaEvent = nullptr;
+        VECMEM_CUDA_ERROR_CHECK(
+            cudaEventCreateWithFlags(&cudaEvent, cudaEventDisableTiming));
+        event = std::make_unique<::cuda_event>(cudaEvent);
+    }
 
     // Record it into the copy object's CUDA stream.
     VECMEM_CUDA_ERROR_CHECK(
-        cudaEventRecord(cudaEvent, details::get_stream(m_stream)));
+        cudaEventRecord(static_cast<::cuda_event&>(*event).m_event,
+                        details::get_stream(m_stream)));
 
-    // Return the smart pointer.
-    return event;
+    // Return the event, set up to be returned to the pool once released.
+    return m_events->make_pooled(std::move(event));
 }
 
 }  // namespace vecmem::cuda
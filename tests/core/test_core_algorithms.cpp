@@ -0,0 +1,205 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/algorithms.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+/// Test case for the @c vecmem::algorithms functions
+class core_algorithms_test : public testing::Test {
+
+protected:
+    /// Sizes to test the algorithms with
+    ///
+    /// Both sizes that are processed by a single thread, and ones that are
+    /// split up between multiple threads, with sizes that are not multiples
+    /// of the block sizes.
+    static std::vector<std::size_t> sizes() {
+        return {0u, 1u, 1000u, 100003u};
+    }
+
+    /// Memory resource for the test(s)
+    vecmem::host_memory_resource m_resource;
+    /// Thread pool for the test(s)
+    vecmem::thread_pool m_pool{3};
+    /// Random number generator for the test(s)
+    std::mt19937 m_rng{12345};
+
+};  // class core_algorithms_test
+
+/// Tests for @c vecmem::algorithms::reduce
+TEST_F(core_algorithms_test, reduce) {
+
+    for (std::size_t size : sizes()) {
+        vecmem::vector<long> input(size, &m_resource);
+        std::iota(input.begin(), input.end(), -50);
+        EXPECT_EQ(vecmem::algorithms::reduce(m_pool, vecmem::get_data(input)),
+                  std::accumulate(input.begin(), input.end(), 0l));
+        EXPECT_EQ(vecmem::algorithms::reduce(
+                      m_pool, vecmem::get_data(input),
+                      std::numeric_limits<long>::min(),
+                      [](long a, long b) { return std::max(a, b); }),
+                  (size == 0 ? std::numeric_limits<long>::min()
+                             : static_cast<long>(size) - 51));
+    }
+
+    // The reduction happens in the type of the initial value.
+    vecmem::vector<int> large(100003, std::numeric_limits<int>::max(),
+                              &m_resource);
+    EXPECT_EQ(vecmem::algorithms::reduce(m_pool, vecmem::get_data(large), 0ll),
+              100003ll * std::numeric_limits<int>::max());
+}
+
+/// Tests for the scan functions
+TEST_F(core_algorithms_test, scan) {
+
+    for (std::size_t size : sizes()) {
+
+        vecmem::vector<unsigned int> input(size, &m_resource);
+        std::uniform_int_distribution<unsigned int> dist(0, 10);
+        std::generate(input.begin(), input.end(),
+                      [&]() { return dist(m_rng); });
+
+        // Inclusive scan into a separate vector.
+        std::vector<unsigned int> reference(size);
+        std::partial_sum(input.begin(), input.end(), reference.begin());
+        vecmem::vector<unsigned int> output(size, &m_resource);
+        vecmem::algorithms::inclusive_scan(m_pool, vecmem::get_data(input),
+                                           vecmem::get_data(output));
+        EXPECT_TRUE(std::equal(reference.begin(), reference.end(),
+                               output.begin(), output.end()));
+
+        // Exclusive scan into a resizable buffer.
+        vecmem::data::vector_buffer<unsigned int> buffer(
+            static_cast<unsigned int>(size), 0u, m_resource);
+        vecmem::copy().setup(buffer)->wait();
+        const unsigned int total = vecmem::algorithms::exclusive_scan(
+            m_pool, vecmem::get_data(input), vecmem::get_data(buffer), 5u);
+        ASSERT_EQ(buffer.size(), size);
+        EXPECT_EQ(total, 5u + (size == 0 ? 0u : reference.back()));
+        for (std::size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(buffer.ptr()[i], 5u + reference[i] - input[i]);
+        }
+
+        // Exclusive scan in place.
+        auto input_data = vecmem::get_data(input);
+        vecmem::algorithms::exclusive_scan(m_pool, input_data, input_data);
+        EXPECT_TRUE(std::equal(input.begin(), input.end(), buffer.ptr(),
+                               buffer.ptr() + size,
+                               [](unsigned int a, unsigned int b) {
+                                   return a + 5u == b;
+                               }));
+    }
+
+    // Test that too small output views are detected.
+    vecmem::vector<int> input(10, &m_resource);
+    vecmem::vector<int> output(5, &m_resource);
+    EXPECT_THROW(vecmem::algorithms::inclusive_scan(
+                     m_pool, vecmem::get_data(input), vecmem::get_data(output)),
+                 std::length_error);
+}
+
+/// Tests for @c vecmem::algorithms::sort
+TEST_F(core_algorithms_test, sort) {
+
+    for (std::size_t size : sizes()) {
+
+        // Signed integers.
+        vecmem::vector<int> ints(size, &m_resource);
+        std::uniform_int_distribution<int> idist(-1000000, 1000000);
+        std::generate(ints.begin(), ints.end(), [&]() { return idist(m_rng); });
+        std::vector<int> ints_ref(ints.begin(), ints.end());
+        std::sort(ints_ref.begin(), ints_ref.end());
+        vecmem::algorithms::sort(m_pool, vecmem::get_data(ints));
+        EXPECT_TRUE(std::equal(ints_ref.begin(), ints_ref.end(), ints.begin(),
+                               ints.end()));
+
+        // Unsigned integers, with only some of their digits differing.
+        vecmem::vector<std::uint64_t> uints(size, &m_resource);
+        std::uniform_int_distribution<std::uint64_t> udist(0, 1000);
+        std::generate(uints.begin(), uints.end(),
+                      [&]() { return udist(m_rng) << 20; });
+        std::vector<std::uint64_t> uints_ref(uints.begin(), uints.end());
+        std::sort(uints_ref.begin(), uints_ref.end());
+        vecmem::algorithms::sort(m_pool, vecmem::get_data(uints));
+        EXPECT_TRUE(std::equal(uints_ref.begin(), uints_ref.end(),
+                               uints.begin(), uints.end()));
+
+        // Floating point numbers.
+        vecmem::vector<float> floats(size, &m_resource);
+        std::uniform_real_distribution<float> fdist(-100.f, 100.f);
+        std::generate(floats.begin(), floats.end(),
+                      [&]() { return fdist(m_rng); });
+        std::vector<float> floats_ref(floats.begin(), floats.end());
+        std::sort(floats_ref.begin(), floats_ref.end());
+        vecmem::algorithms::sort(m_pool, vecmem::get_data(floats));
+        EXPECT_TRUE(std::equal(floats_ref.begin(), floats_ref.end(),
+                               floats.begin(), floats.end()));
+    }
+}
+
+/// Tests for @c vecmem::algorithms::partition
+TEST_F(core_algorithms_test, partition) {
+
+    for (std::size_t size : sizes()) {
+
+        vecmem::vector<int> data(size, &m_resource);
+        std::iota(data.begin(), data.end(), 0);
+        std::vector<int> reference(data.begin(), data.end());
+        auto is_even = [](int value) { return value % 2 == 0; };
+        const auto n_even = std::stable_partition(reference.begin(),
+                                                  reference.end(), is_even) -
+                            reference.begin();
+
+        EXPECT_EQ(vecmem::algorithms::partition(
+                      m_pool, vecmem::get_data(data), is_even),
+                  n_even);
+        EXPECT_TRUE(std::equal(reference.begin(), reference.end(),
+                               data.begin(), data.end()));
+    }
+}
+
+/// Tests for @c vecmem::algorithms::copy_if
+TEST_F(core_algorithms_test, copy_if) {
+
+    for (std::size_t size : sizes()) {
+
+        vecmem::vector<int> input(size, &m_resource);
+        std::iota(input.begin(), input.end(), 0);
+        auto selected = [](int value) { return value % 3 == 1; };
+        std::vector<int> reference;
+        std::copy_if(input.begin(), input.end(), std::back_inserter(reference),
+                     selected);
+
+        vecmem::data::vector_buffer<int> buffer(
+            static_cast<unsigned int>(size), 0u, m_resource);
+        vecmem::copy().setup(buffer)->wait();
+        EXPECT_EQ(vecmem::algorithms::copy_if(
+                      m_pool, vecmem::get_data(input), vecmem::get_data(buffer),
+                      selected),
+                  reference.size());
+        EXPECT_EQ(buffer.size(), reference.size());
+        EXPECT_TRUE(std::equal(reference.begin(), reference.end(),
+                               buffer.ptr(), buffer.ptr() + buffer.size()));
+    }
+}
@@ -0,0 +1,193 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/codec.hpp"
+#include "vecmem/utils/delta_bitpack_codec.hpp"
+#include "vecmem/utils/shuffle_lz_codec.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Compress and decompress a block of memory, checking the result
+std::size_t round_trip(const vecmem::codec& c, const void* data,
+                       std::size_t size, vecmem::thread_pool* pool = nullptr) {
+
+    std::vector<char> frame(c.max_compressed_size(size));
+    const std::size_t frame_size =
+        c.compress(data, size, frame.data(), frame.size(), pool);
+    EXPECT_LE(frame_size, frame.size());
+    EXPECT_EQ(vecmem::codec::decompressed_size(frame.data(), frame_size),
+              size);
+    std::vector<char> result(size);
+    c.decompress(frame.data(), frame_size, result.data(), size, pool);
+    if (size != 0) {
+        EXPECT_EQ(std::memcmp(result.data(), data, size), 0);
+    }
+    return frame_size;
+}
+
+/// Sorted indices, with small gaps between them
+std::vector<std::uint32_t> sorted_indices(std::size_t size) {
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint32_t> dist(0, 10);
+    std::vector<std::uint32_t> result(size);
+    std::uint32_t value = 1000000;
+    for (std::uint32_t& element : result) {
+        value += dist(gen);
+        element = value;
+    }
+    return result;
+}
+
+/// Sparse "hit map", with most elements being zero
+std::vector<std::uint32_t> sparse_hits(std::size_t size) {
+
+    std::vector<std::uint32_t> result(size, 0);
+    for (std::size_t i = 0; i < size; i += 97) {
+        result[i] = static_cast<std::uint32_t>(i);
+    }
+    return result;
+}
+
+/// Random (incompressible) bytes
+std::vector<unsigned char> random_bytes(std::size_t size) {
+
+    std::mt19937 gen(123);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<unsigned char> result(size);
+    for (unsigned char& element : result) {
+        element = static_cast<unsigned char>(dist(gen));
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Test the compression ratio of the shuffling LZ77 codec
+TEST(core_shuffle_lz_codec_test, ratio) {
+
+    const vecmem::shuffle_lz_codec c(sizeof(std::uint32_t));
+
+    const std::vector<std::uint32_t> indices = sorted_indices(100000);
+    const std::size_t size = indices.size() * sizeof(std::uint32_t);
+    EXPECT_LT(round_trip(c, indices.data(), size), size / 2);
+
+    const std::vector<std::uint32_t> hits = sparse_hits(100000);
+    EXPECT_LT(round_trip(c, hits.data(), size), size / 10);
+}
+
+/// Test the compression ratio of the delta/bit-packing codec
+TEST(core_delta_bitpack_codec_test, ratio) {
+
+    const vecmem::delta_bitpack_codec c(sizeof(std::uint32_t));
+
+    const std::vector<std::uint32_t> indices = sorted_indices(100000);
+    const std::size_t size = indices.size() * sizeof(std::uint32_t);
+    EXPECT_LT(round_trip(c, indices.data(), size), size / 6);
+
+    EXPECT_THROW(vecmem::delta_bitpack_codec(3), std::invalid_argument);
+}
+
+/// Test case for the codecs
+class core_codec_test
+    : public testing::TestWithParam<std::shared_ptr<vecmem::codec>> {};
+
+/// Test (de-)compressing some compressible data
+TEST_P(core_codec_test, compressible) {
+
+    const vecmem::codec& c = *(GetParam());
+
+    // Sorted indices.
+    const std::vector<std::uint32_t> indices = sorted_indices(100000);
+    const std::size_t size = indices.size() * sizeof(std::uint32_t);
+    round_trip(c, indices.data(), size);
+
+    // A sparse "hit map".
+    const std::vector<std::uint32_t> hits = sparse_hits(100000);
+    round_trip(c, hits.data(), size);
+}
+
+/// Test (de-)compressing some edge cases
+TEST_P(core_codec_test, edge_cases) {
+
+    const vecmem::codec& c = *(GetParam());
+
+    // Empty input.
+    round_trip(c, nullptr, 0);
+
+    // Incompressible data.
+    const std::vector<unsigned char> bytes = random_bytes(600000);
+    EXPECT_LE(round_trip(c, bytes.data(), bytes.size()),
+              c.max_compressed_size(bytes.size()));
+
+    // Sizes that are not multiples of the element/chunk sizes.
+    const std::vector<std::uint32_t> indices = sorted_indices(100000);
+    for (std::size_t size : {1u, 3u, 7u, 13u, 1001u, 262147u}) {
+        round_trip(c, indices.data(), size);
+    }
+}
+
+/// Test (de-)compressing with multiple threads
+TEST_P(core_codec_test, parallel) {
+
+    const vecmem::codec& c = *(GetParam());
+    vecmem::thread_pool pool(3);
+
+    const std::vector<std::uint32_t> indices = sorted_indices(1000000);
+    const std::size_t size = indices.size() * sizeof(std::uint32_t);
+    const std::size_t frame_size = round_trip(c, indices.data(), size, &pool);
+    EXPECT_EQ(frame_size, round_trip(c, indices.data(), size));
+}
+
+/// Test the handling of invalid frames
+TEST_P(core_codec_test, invalid) {
+
+    const vecmem::codec& c = *(GetParam());
+
+    const std::vector<std::uint32_t> indices = sorted_indices(10000);
+    const std::size_t size = indices.size() * sizeof(std::uint32_t);
+    std::vector<char> frame(c.max_compressed_size(size));
+    const std::size_t frame_size =
+        c.compress(indices.data(), size, frame.data(), frame.size());
+    std::vector<char> result(size);
+
+    // Too small output buffer for the compression.
+    EXPECT_THROW(c.compress(indices.data(), size, frame.data(), 10),
+                 std::length_error);
+    // Incorrect output size for the decompression.
+    EXPECT_THROW(c.decompress(frame.data(), frame_size, result.data(), 10),
+                 std::length_error);
+    // Truncated frame.
+    EXPECT_THROW(
+        c.decompress(frame.data(), frame_size - 10, result.data(), size),
+        std::runtime_error);
+    // Not a frame.
+    EXPECT_THROW(vecmem::codec::decompressed_size(indices.data(), size),
+                 std::runtime_error);
+}
+
+// Set up the test case(s).
+INSTANTIATE_TEST_SUITE_P(
+    core_codec_tests, core_codec_test,
+    testing::Values(std::make_shared<vecmem::shuffle_lz_codec>(),
+                    std::make_shared<vecmem::shuffle_lz_codec>(4),
+                    std::make_shared<vecmem::shuffle_lz_codec>(8, 1000),
+                    std::make_shared<vecmem::delta_bitpack_codec>(),
+                    std::make_shared<vecmem::delta_bitpack_codec>(8, 1000)));
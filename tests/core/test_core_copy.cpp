@@ -11,18 +11,73 @@
 #include "vecmem/containers/device_vector.hpp"
 #include "vecmem/containers/jagged_device_vector.hpp"
 #include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/tracked_vector.hpp"
 #include "vecmem/containers/vector.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
 #include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+#include "vecmem/utils/copy_plan.hpp"
+#include "vecmem/utils/delta_bitpack_codec.hpp"
+#include "vecmem/utils/thread_pool.hpp"
 
 // GoogleTest include(s).
 #include <gtest/gtest.h>
 
 // System include(s).
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
 #include <tuple>
 #include <vector>
 
+namespace {
+
+/// Copy object counting the "low level" operations that it performs
+class counting_copy : public vecmem::copy {
+
+public:
+    /// The number of @c do_copy calls made
+    mutable std::size_t m_copies = 0;
+    /// The number of @c do_copy_batch calls made
+    mutable std::size_t m_batches = 0;
+    /// The number of bytes copied with @c do_copy
+    mutable std::size_t m_bytes = 0;
+    /// The number of @c do_memset calls made
+    mutable std::size_t m_memsets = 0;
+
+protected:
+    void do_copy(std::size_t size, const void* from, void* to,
+                 type::copy_type cptype) const override {
+        ++m_copies;
+        m_bytes += size;
+        vecmem::copy::do_copy(size, from, to, cptype);
+    }
+    void do_copy_batch(const std::vector<segment>& segments,
+                       type::copy_type cptype) const override {
+        ++m_batches;
+        vecmem::copy::do_copy_batch(segments, cptype);
+    }
+    void do_memset(std::size_t size, void* ptr, int value) const override {
+        ++m_memsets;
+        vecmem::copy::do_memset(size, ptr, value);
+    }
+
+};  // class counting_copy
+
+/// Copy object failing all of its copy batches
+class failing_copy : public vecmem::copy {
+
+protected:
+    void do_copy_batch(const std::vector<segment>&,
+                       type::copy_type) const override {
+        throw std::runtime_error("Copy failure");
+    }
+
+};  // class failing_copy
+
+}  // namespace
+
 /// Test case for testing @c vecmem::copy
 class core_copy_test : public testing::Test {
 
@@ -459,3 +514,767 @@ TEST_F(core_copy_test, memset) {
         }
     }
 }
+
+/// Tests with @c vecmem::copy_batch
+TEST_F(core_copy_test, batch) {
+
+    // Set up the source and target arrays.
+    vecmem::vector<int> source(100, &m_resource);
+    std::iota(source.begin(), source.end(), 0);
+    vecmem::vector<int> target(100, 0, &m_resource);
+
+    // Describe them as multiple views, next to each other.
+    using vecmem_size_type = vecmem::data::vector_view<int>::size_type;
+    const std::vector<vecmem_size_type> offsets = {0, 10, 30, 100};
+
+    // Create a jagged source and a resizable jagged target.
+    const vecmem::jagged_vector<int> jagged_source = {
+        {{{1, 2, 3}, &m_resource},
+         {{4, 5}, &m_resource},
+         vecmem::vector<int>(&m_resource),
+         {{6, 7, 8, 9}, &m_resource}},
+        &m_resource};
+    vecmem::data::jagged_vector_buffer<int> jagged_target(
+        std::vector<std::size_t>(4, 0), std::vector<std::size_t>(4, 5),
+        m_resource);
+    m_copy.setup(jagged_target);
+
+    // Collect all the copies into a batch.
+    counting_copy copy;
+    vecmem::copy_batch batch(copy);
+    for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+        vecmem::data::vector_view<int> from(offsets[i + 1] - offsets[i],
+                                            source.data() + offsets[i]);
+        vecmem::data::vector_view<int> to(offsets[i + 1] - offsets[i],
+                                          target.data() + offsets[i]);
+        batch.add(from, to);
+    }
+    batch.add(vecmem::get_data(jagged_source), jagged_target);
+    EXPECT_EQ(batch.segments().size(), 7u);
+
+    // Perform the copies.
+    copy(batch)->wait();
+    EXPECT_EQ(copy.m_batches, 1u);
+    // The 1D views must have been merged into a single copy, while the 3
+    // non-empty inner vectors of the jagged vector, and their sizes, need
+    // separate copies.
+    EXPECT_EQ(copy.m_copies, 5u);
+
+    // Check the results.
+    EXPECT_EQ(source, target);
+    vecmem::jagged_vector<int> jagged_result(&m_resource);
+    m_copy(jagged_target, jagged_result);
+    EXPECT_EQ(jagged_source, jagged_result);
+
+    // Make sure that an emptied batch does not do anything.
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    copy(batch)->wait();
+    EXPECT_EQ(copy.m_batches, 1u);
+    EXPECT_EQ(copy.m_copies, 5u);
+
+    // Make sure that invalid jagged copies are not added to the batch.
+    vecmem::data::jagged_vector_buffer<int> small_target(
+        std::vector<std::size_t>(4, 0), std::vector<std::size_t>(4, 2),
+        m_resource);
+    m_copy.setup(small_target);
+    EXPECT_THROW(batch.add(vecmem::get_data(jagged_source), small_target),
+                 std::runtime_error);
+    EXPECT_TRUE(batch.empty());
+}
+
+/// Tests for copying into resizable jagged vector buffers
+TEST_F(core_copy_test, jagged_vector_into_resizable_buffer) {
+
+    // Create a reference vector.
+    const vecmem::jagged_vector<int> reference = {
+        {{{1, 2, 3, 4, 5}, &m_resource},
+         {{6, 7}, &m_resource},
+         vecmem::vector<int>(&m_resource),
+         {{8, 9, 10, 11}, &m_resource}},
+        &m_resource};
+
+    // Create a resizable target buffer that is large enough.
+    vecmem::data::jagged_vector_buffer<int> target(
+        std::vector<std::size_t>(reference.size(), 0),
+        std::vector<std::size_t>(reference.size(), 10), m_resource);
+    m_copy.setup(target);
+
+    // Perform the copy, and check its results.
+    m_copy(vecmem::get_data(reference), target);
+    vecmem::jagged_vector<int> result(&m_resource);
+    m_copy(target, result);
+    EXPECT_EQ(reference, result);
+
+    // Make sure that a too small target would not be accepted.
+    vecmem::data::jagged_vector_buffer<int> small_target(
+        std::vector<std::size_t>(reference.size(), 0),
+        std::vector<std::size_t>(reference.size(), 2), m_resource);
+    m_copy.setup(small_target);
+    EXPECT_THROW(m_copy(vecmem::get_data(reference), small_target),
+                 std::runtime_error);
+}
+
+/// Tests for getting the sizes of many buffers in one go
+TEST_F(core_copy_test, batched_get_sizes) {
+
+    // Set up a couple of resizable and non-resizable 1D buffers.
+    using vecmem_size_type = vecmem::data::vector_view<int>::size_type;
+    const std::vector<vecmem_size_type> sizes = {2, 0, 7, 5};
+    std::vector<vecmem::data::vector_buffer<int>> buffers;
+    for (vecmem_size_type size : sizes) {
+        buffers.emplace_back(10, 0, m_resource);
+        m_copy.setup(buffers.back());
+        vecmem::device_vector<int> vec(buffers.back());
+        vec.resize(size);
+    }
+    buffers.emplace_back(3, m_resource);
+    std::vector<vecmem::data::vector_view<int>> views(buffers.begin(),
+                                                      buffers.end());
+
+    // Get their sizes in one go.
+    counting_copy copy;
+    const std::vector<vecmem_size_type> result = copy.get_sizes(views);
+    EXPECT_EQ(copy.m_batches, 1u);
+    ASSERT_EQ(result.size(), sizes.size() + 1);
+    EXPECT_TRUE(std::equal(sizes.begin(), sizes.end(), result.begin()));
+    EXPECT_EQ(result.back(), 3u);
+
+    // Get them asynchronously as well.
+    auto async_sizes = copy.get_sizes_async(views);
+    EXPECT_TRUE(async_sizes.valid());
+    EXPECT_EQ(async_sizes.get(), result);
+    EXPECT_EQ(copy.m_batches, 2u);
+
+    // Set up a couple of resizable jagged buffers.
+    std::vector<vecmem::data::jagged_vector_buffer<int>> jagged_buffers;
+    jagged_buffers.emplace_back(std::vector<std::size_t>(3, 0),
+                                std::vector<std::size_t>(3, 5), m_resource);
+    jagged_buffers.emplace_back(std::vector<std::size_t>(4, 0),
+                                std::vector<std::size_t>({0, 2, 3, 4}),
+                                m_resource);
+    for (auto& buffer : jagged_buffers) {
+        m_copy.setup(buffer);
+        vecmem::jagged_device_vector<int> vec(buffer);
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            vec[i].resize(static_cast<vecmem_size_type>(
+                std::min<std::size_t>(i + 1, vec[i].capacity())));
+        }
+    }
+    std::vector<vecmem::data::jagged_vector_view<int>> jagged_views(
+        jagged_buffers.begin(), jagged_buffers.end());
+
+    // Get their sizes in one go.
+    const auto jagged_result = copy.get_sizes(jagged_views);
+    EXPECT_EQ(copy.m_batches, 3u);
+    ASSERT_EQ(jagged_result.size(), 2u);
+    EXPECT_EQ(jagged_result[0], std::vector<vecmem_size_type>({1, 2, 3}));
+    EXPECT_EQ(jagged_result[1], std::vector<vecmem_size_type>({0, 2, 3, 4}));
+    for (std::size_t i = 0; i < jagged_views.size(); ++i) {
+        EXPECT_EQ(jagged_result[i], m_copy.get_sizes(jagged_views[i]));
+    }
+}
+
+/// Tests for copying 1D vectors into re-usable buffers
+TEST_F(core_copy_test, vector_to_reused_buffer) {
+
+    // Create a fixed sized and a resizable source.
+    vecmem::vector<int> fixed_source = {{1, 2, 3, 4}, &m_resource};
+    vecmem::data::vector_buffer<int> resizable_source(10, 0, m_resource);
+    m_copy.setup(resizable_source);
+    vecmem::device_vector<int> resizable_vec(resizable_source);
+    resizable_vec.push_back(5);
+    resizable_vec.push_back(6);
+
+    // Copy the fixed sized source into an empty buffer.
+    vecmem::data::vector_buffer<int> buffer;
+    m_copy.to(vecmem::get_data(fixed_source), buffer, m_resource)->wait();
+    EXPECT_EQ(buffer.size_ptr(), nullptr);
+    std::vector<int> result;
+    m_copy(buffer, result);
+    EXPECT_TRUE(std::equal(result.begin(), result.end(),
+                           fixed_source.begin(), fixed_source.end()));
+
+    // Copying it again should not re-allocate the buffer.
+    const int* ptr = buffer.ptr();
+    fixed_source[2] = 7;
+    m_copy.to(vecmem::get_data(fixed_source), buffer, m_resource)->wait();
+    EXPECT_EQ(buffer.ptr(), ptr);
+    m_copy(buffer, result);
+    EXPECT_TRUE(std::equal(result.begin(), result.end(),
+                           fixed_source.begin(), fixed_source.end()));
+
+    // Copying the resizable source requires a new, resizable buffer.
+    m_copy.to(resizable_source, buffer, m_resource)->wait();
+    EXPECT_NE(buffer.size_ptr(), nullptr);
+    EXPECT_EQ(buffer.capacity(), 10u);
+    m_copy(buffer, result);
+    EXPECT_EQ(result, std::vector<int>({5, 6}));
+
+    // Which can then be re-used after the source grows.
+    ptr = buffer.ptr();
+    resizable_vec.push_back(8);
+    m_copy.to(resizable_source, buffer, m_resource)->wait();
+    EXPECT_EQ(buffer.ptr(), ptr);
+    m_copy(buffer, result);
+    EXPECT_EQ(result, std::vector<int>({5, 6, 8}));
+
+    // Test the asynchronous version as well.
+    auto async_buffer = m_copy.to_async(resizable_source, m_resource);
+    m_copy(async_buffer.get(), result);
+    EXPECT_EQ(result, std::vector<int>({5, 6, 8}));
+}
+
+/// Tests for copying jagged vectors into re-usable buffers
+TEST_F(core_copy_test, jagged_vector_to_reused_buffer) {
+
+    // Create a source jagged vector.
+    vecmem::jagged_vector<int> source = {{{{1, 2, 3}, &m_resource},
+                                          {{4, 5}, &m_resource},
+                                          vecmem::vector<int>(&m_resource)},
+                                         &m_resource};
+
+    // Copy it into a new buffer.
+    vecmem::data::jagged_vector_buffer<int> buffer;
+    m_copy.to(vecmem::get_data(source), buffer, m_resource)->wait();
+    vecmem::jagged_vector<int> result(&m_resource);
+    m_copy(buffer, result);
+    EXPECT_EQ(result, source);
+
+    // Copying a source with smaller inner vectors should not re-allocate the
+    // buffer.
+    const int* ptr = buffer.host_ptr()[0].ptr();
+    source[0].pop_back();
+    source[1].pop_back();
+    m_copy.to(vecmem::get_data(source), buffer, m_resource)->wait();
+    EXPECT_EQ(buffer.host_ptr()[0].ptr(), ptr);
+    m_copy(buffer, result);
+    EXPECT_EQ(result, source);
+
+    // Copying a source with a larger inner vector needs a re-allocation.
+    source[2].push_back(6);
+    m_copy.to(vecmem::get_data(source), buffer, m_resource)->wait();
+    m_copy(buffer, result);
+    EXPECT_EQ(result, source);
+    EXPECT_EQ(buffer.host_ptr()[0].capacity(), 3u);
+    EXPECT_EQ(buffer.host_ptr()[2].capacity(), 1u);
+
+    // Test the asynchronous version as well.
+    auto async_buffer = m_copy.to_async(vecmem::get_data(source), m_resource);
+    m_copy(async_buffer.get(), result);
+    EXPECT_EQ(result, source);
+}
+
+/// Tests for packing non-contiguous jagged copies through a staging buffer
+TEST_F(core_copy_test, staged_jagged_copy) {
+
+    // Create a (non-contiguous) jagged vector with many small inner vectors.
+    vecmem::jagged_vector<int> source(&m_resource);
+    for (int i = 0; i < 50; ++i) {
+        source.emplace_back(i % 7);
+        std::iota(source.back().begin(), source.back().end(), i);
+    }
+    const auto source_data = vecmem::get_data(source);
+
+    // Create a (contiguous) buffer for it.
+    vecmem::data::jagged_vector_buffer<int> buffer(
+        std::vector<std::size_t>(source.size(), 0),
+        std::vector<std::size_t>(source.size(), 10), m_resource);
+    m_copy.setup(buffer);
+
+    // Perform the copies with and without a thread pool.
+    vecmem::thread_pool pool(2);
+    const std::vector<vecmem::thread_pool*> pools = {&pool, nullptr};
+    for (vecmem::thread_pool* pool_ptr : pools) {
+
+        // Set up a copy object that would use a staging buffer.
+        counting_copy copy;
+        vecmem::copy::staging_config staging;
+        staging.resource = &m_resource;
+        staging.pool = pool_ptr;
+        copy.set_staging(staging);
+
+        // Copying "into the device" should be done with a single copy for
+        // the payload. (And one for the sizes.)
+        copy(source_data, buffer, vecmem::copy::type::host_to_device)->wait();
+        EXPECT_EQ(copy.m_copies, 2u);
+
+        // Copying "out of the device" should also use a single copy for the
+        // payload. (And one for fetching the sizes.)
+        vecmem::jagged_vector<int> result(&m_resource);
+        copy(buffer, result, vecmem::copy::type::device_to_host)->wait();
+        EXPECT_EQ(source, result);
+        EXPECT_EQ(copy.m_copies, 4u);
+
+        // Copies with an unknown direction should not be staged.
+        copy(source_data, buffer)->wait();
+        EXPECT_GT(copy.m_copies, 10u);
+    }
+}
+
+/// Tests for recording and replaying copy plans
+TEST_F(core_copy_test, plan) {
+
+    // Set up the sources.
+    vecmem::vector<int> source1 = {{1, 2, 3, 4}, &m_resource};
+    vecmem::data::vector_buffer<int> source2(10, 0, m_resource);
+    m_copy.setup(source2);
+    vecmem::device_vector<int> source2_vec(source2);
+    source2_vec.push_back(5);
+    vecmem::jagged_vector<int> source3 = {{{{1, 2}, &m_resource},
+                                           {{3, 4, 5}, &m_resource},
+                                           vecmem::vector<int>(&m_resource)},
+                                          &m_resource};
+
+    // Set up the targets.
+    vecmem::data::vector_buffer<int> target1(10, 0, m_resource);
+    vecmem::data::vector_buffer<int> target2(10, 0, m_resource);
+    vecmem::data::jagged_vector_buffer<int> target3(
+        std::vector<std::size_t>(3, 0), std::vector<std::size_t>(3, 4),
+        m_resource);
+    m_copy.setup(target3);
+    vecmem::data::vector_buffer<int> target4(5, m_resource);
+
+    // Record the plan.
+    vecmem::copy_plan plan;
+    const auto bindings1 = plan.add(vecmem::get_data(source1), target1);
+    plan.add(source2, target2);
+    plan.add(vecmem::get_data(source3), target3);
+    plan.memset(target4, 0);
+    EXPECT_FALSE(plan.empty());
+
+    // Replay it a couple of times, with changing sources.
+    counting_copy copy;
+    for (int i = 0; i < 3; ++i) {
+
+        // Modify the sources.
+        source1[0] = i;
+        source2_vec.push_back(i);
+        source3[1][2] = i;
+
+        // Replay the plan.
+        copy(plan)->wait();
+        EXPECT_EQ(copy.m_batches, static_cast<std::size_t>(i + 1));
+
+        // Check the results.
+        std::vector<int> result;
+        m_copy(target1, result);
+        EXPECT_TRUE(std::equal(result.begin(), result.end(), source1.begin(),
+                               source1.end()));
+        m_copy(target2, result);
+        EXPECT_EQ(result.size(), static_cast<std::size_t>(i + 2));
+        EXPECT_EQ(result.back(), i);
+        vecmem::jagged_vector<int> jagged_result(&m_resource);
+        m_copy(target3, jagged_result);
+        EXPECT_EQ(jagged_result, source3);
+        m_copy(target4, result);
+        EXPECT_EQ(result, std::vector<int>(5, 0));
+    }
+
+    // Point the first copy at a different target.
+    vecmem::data::vector_buffer<int> target5(10, 0, m_resource);
+    plan.rebind(bindings1.to, vecmem::get_data(target5));
+    copy(plan)->wait();
+    std::vector<int> result;
+    m_copy(target5, result);
+    EXPECT_TRUE(std::equal(result.begin(), result.end(), source1.begin(),
+                           source1.end()));
+
+    // Check that invalid recordings are rejected.
+    vecmem::data::vector_buffer<int> small(2, m_resource);
+    EXPECT_THROW(plan.add(vecmem::get_data(source1), small),
+                 std::length_error);
+    vecmem::data::vector_buffer<int> fixed(10, m_resource);
+    EXPECT_THROW(plan.add(source2, fixed), std::invalid_argument);
+    EXPECT_THROW(plan.rebind(1000, vecmem::get_data(target5)),
+                 std::out_of_range);
+}
+
+/// Tests for copying only the modified parts of a vector
+TEST_F(core_copy_test, update) {
+
+    // Set up the source and the target.
+    vecmem::tracked_vector<int> source(1000, 1, m_resource);
+    vecmem::data::vector_buffer<int> target(1000, m_resource);
+
+    // The first update should copy everything.
+    counting_copy copy;
+    copy.update(vecmem::get_data(source), target, source.dirty())->wait();
+    EXPECT_EQ(copy.m_batches, 1u);
+    EXPECT_TRUE(source.dirty().empty());
+    vecmem::device_vector<int> target_vec(target);
+    EXPECT_TRUE(std::equal(source.begin(), source.end(), target_vec.begin(),
+                           target_vec.end()));
+
+    // Modify some parts of the source, and some other parts of the target,
+    // which should not be overwritten.
+    source.set(10, 2);
+    source.set(11, 3);
+    source.modify(500, 510)[5] = 4;
+    target_vec[300] = 5;
+
+    // Perform the incremental copy.
+    copy.update(vecmem::get_data(source), target, source.dirty())->wait();
+    EXPECT_EQ(copy.m_batches, 2u);
+    EXPECT_EQ(target_vec[10], 2);
+    EXPECT_EQ(target_vec[11], 3);
+    EXPECT_EQ(target_vec[505], 4);
+    EXPECT_EQ(target_vec[300], 5);
+
+    // Updates without any modifications should not copy anything.
+    copy.update(vecmem::get_data(source), target, source.dirty())->wait();
+    EXPECT_EQ(copy.m_batches, 2u);
+
+    // Failed updates should not forget about the modified ranges.
+    source.set(20, 6);
+    failing_copy failing;
+    EXPECT_THROW(
+        failing.update(vecmem::get_data(source), target, source.dirty()),
+        std::runtime_error);
+    EXPECT_FALSE(source.dirty().empty());
+    copy.update(vecmem::get_data(source), target, source.dirty())->wait();
+    EXPECT_EQ(copy.m_batches, 3u);
+    EXPECT_EQ(target_vec[20], 6);
+
+    // Invalid targets.
+    vecmem::data::vector_buffer<int> small(100, m_resource);
+    EXPECT_THROW(copy.update(vecmem::get_data(source), small, source.dirty()),
+                 std::length_error);
+    vecmem::data::vector_buffer<int> resizable(1000, 0, m_resource);
+    EXPECT_THROW(
+        copy.update(vecmem::get_data(source), resizable, source.dirty()),
+        std::invalid_argument);
+}
+
+/// Tests for type-converting copies
+TEST_F(core_copy_test, convert) {
+
+    // Set up the source.
+    vecmem::vector<double> source(&m_resource);
+    for (int i = 0; i < 1000; ++i) {
+        source.push_back(i * 0.5);
+    }
+
+    // Convert it into a "device" buffer.
+    counting_copy copy;
+    vecmem::data::vector_buffer<float> device(1000, m_resource);
+    copy.convert(vecmem::get_data(source), vecmem::get_data(device),
+                 vecmem::copy::type::host_to_device)
+        ->wait();
+    EXPECT_EQ(copy.m_bytes, 1000 * sizeof(float));
+    vecmem::device_vector<const float> device_vec(device);
+    for (unsigned int i = 0; i < 1000; ++i) {
+        EXPECT_FLOAT_EQ(device_vec[i], static_cast<float>(source[i]));
+    }
+
+    // Convert it back into a resizable host buffer, using multiple threads.
+    vecmem::thread_pool pool(2);
+    copy.set_staging({&m_resource, 16, 64 * 1024, &pool});
+    vecmem::data::vector_buffer<double> host(2000, 0, m_resource);
+    copy.setup(host);
+    const std::size_t bytes = copy.m_bytes;
+    copy.convert(vecmem::get_data(device), vecmem::get_data(host),
+                 vecmem::copy::type::device_to_host)
+        ->wait();
+    // The size of the host buffer is set directly, not with a copy.
+    EXPECT_EQ(copy.m_bytes - bytes, 1000 * sizeof(float));
+    vecmem::device_vector<double> host_vec(host);
+    EXPECT_EQ(host_vec.size(), 1000u);
+    EXPECT_TRUE(std::equal(host_vec.begin(), host_vec.end(), source.begin(),
+                           source.end()));
+
+    // Narrow integers on the host.
+    vecmem::vector<std::int64_t> indices = {{1, 2, 3, 100000}, &m_resource};
+    vecmem::vector<std::int32_t> narrow(4, &m_resource);
+    copy.convert(vecmem::get_data(indices), vecmem::get_data(narrow),
+                 vecmem::copy::type::host_to_host)
+        ->wait();
+    EXPECT_EQ(narrow, vecmem::vector<std::int32_t>({1, 2, 3, 100000}));
+
+    // Invalid conversions.
+    EXPECT_THROW(copy.convert(vecmem::get_data(indices),
+                              vecmem::get_data(narrow),
+                              vecmem::copy::type::unknown),
+                 std::invalid_argument);
+    narrow.resize(2);
+    EXPECT_THROW(copy.convert(vecmem::get_data(indices),
+                              vecmem::get_data(narrow),
+                              vecmem::copy::type::host_to_host),
+                 std::length_error);
+}
+
+/// Tests for compressed host-to-host copies
+TEST_F(core_copy_test, compressed) {
+
+    // Set up a compressible source.
+    vecmem::vector<unsigned int> source(&m_resource);
+    for (unsigned int i = 0; i < 100000; ++i) {
+        source.push_back(3 * i);
+    }
+    const std::size_t size = source.size() * sizeof(unsigned int);
+
+    // Set up the copy object.
+    counting_copy copy;
+    vecmem::delta_bitpack_codec codec;
+    vecmem::thread_pool pool(2);
+    copy.set_compression({&codec, 1000, nullptr, &pool});
+
+    // Copy the vector.
+    vecmem::data::vector_buffer<unsigned int> buffer(100000, m_resource);
+    copy(vecmem::get_data(source), buffer, vecmem::copy::type::host_to_host)
+        ->wait();
+    EXPECT_LT(copy.m_bytes, size / 2);
+    vecmem::device_vector<unsigned int> buffer_vec(buffer);
+    EXPECT_TRUE(std::equal(source.begin(), source.end(), buffer_vec.begin(),
+                           buffer_vec.end()));
+
+    // Copies in other directions should not be compressed.
+    copy.m_bytes = 0;
+    copy(vecmem::get_data(source), buffer, vecmem::copy::type::host_to_device)
+        ->wait();
+    EXPECT_EQ(copy.m_bytes, size);
+}
+
+/// Tests for pipelined copies through rotating staging buffers
+TEST_F(core_copy_test, pipelined) {
+
+    for (std::size_t n_buffers : {1u, 2u, 3u}) {
+
+        // Set up the copy object.
+        counting_copy copy;
+        vecmem::copy::staging_config config;
+        config.resource = &m_resource;
+        config.chunk_size = 1000;
+        config.n_buffers = n_buffers;
+        copy.set_staging(config);
+
+        // Set up a source vector.
+        vecmem::vector<int> source(&m_resource);
+        for (int i = 0; i < 10001; ++i) {
+            source.push_back(i);
+        }
+
+        // Copy it to a "device" buffer, and back.
+        vecmem::data::vector_buffer<int> device(10001, m_resource);
+        copy(vecmem::get_data(source), device,
+             vecmem::copy::type::host_to_device)
+            ->wait();
+        EXPECT_EQ(copy.m_copies, 41u);
+        vecmem::vector<int> result(&m_resource);
+        copy(device, result, vecmem::copy::type::device_to_host)->wait();
+        EXPECT_EQ(copy.m_copies, 82u);
+        EXPECT_EQ(result, source);
+
+        // Copies below the chunk size should not be pipelined.
+        copy.m_copies = 0;
+        vecmem::data::vector_buffer<int> small_device(100, m_resource);
+        copy(vecmem::data::vector_view<int>(100, source.data()), small_device,
+             vecmem::copy::type::host_to_device)
+            ->wait();
+        EXPECT_EQ(copy.m_copies, 1u);
+
+        // Set up a jagged source vector with many small inner vectors.
+        vecmem::jagged_vector<int> jagged_source(&m_resource);
+        for (int i = 0; i < 500; ++i) {
+            jagged_source.emplace_back(i % 7);
+            std::iota(jagged_source.back().begin(),
+                      jagged_source.back().end(), i);
+        }
+
+        // Copy it to a contiguous "device" buffer, with gaps between the
+        // inner vectors, and back.
+        vecmem::data::jagged_vector_buffer<int> jagged_device(
+            std::vector<std::size_t>(jagged_source.size(), 0),
+            std::vector<std::size_t>(jagged_source.size(), 10), m_resource);
+        copy.setup(jagged_device)->wait();
+        copy(vecmem::get_data(jagged_source), jagged_device,
+             vecmem::copy::type::host_to_device)
+            ->wait();
+        vecmem::jagged_vector<int> jagged_result(&m_resource);
+        copy(jagged_device, jagged_result, vecmem::copy::type::device_to_host)
+            ->wait();
+        EXPECT_EQ(jagged_result, jagged_source);
+    }
+}
+
+/// Tests for filling/setting up jagged vectors with few operations
+TEST_F(core_copy_test, jagged_memset) {
+
+    counting_copy copy;
+    static const std::vector<std::size_t> SIZES = {3, 6, 0, 3, 0, 2, 7, 4};
+
+    // Resizable jagged buffers should be set up, and filled with a single
+    // operation each.
+    vecmem::data::jagged_vector_buffer<int> buffer(
+        std::vector<std::size_t>(SIZES.size(), 0), SIZES, m_resource);
+    copy.setup(buffer)->wait();
+    EXPECT_EQ(copy.m_memsets, 1u);
+    copy.memset(buffer, 1)->wait();
+    EXPECT_EQ(copy.m_memsets, 2u);
+    for (std::size_t i = 0; i < SIZES.size(); ++i) {
+        EXPECT_EQ(*(buffer.host_ptr()[i].size_ptr()), 0u);
+        for (std::size_t j = 0; j < SIZES[i]; ++j) {
+            EXPECT_EQ(buffer.host_ptr()[i].ptr()[j], 0x01010101);
+        }
+    }
+
+    // Jagged vectors need one operation per (non-empty) inner vector.
+    vecmem::jagged_vector<int> vec(&m_resource);
+    for (std::size_t size : SIZES) {
+        vec.emplace_back(size, 3);
+    }
+    copy.m_memsets = 0;
+    copy.memset(vecmem::get_data(vec), 0)->wait();
+    EXPECT_LE(copy.m_memsets, 6u);
+    for (const auto& inner : vec) {
+        for (int value : inner) {
+            EXPECT_EQ(value, 0);
+        }
+    }
+
+    // Resizable views with scattered size variables should still work.
+    vecmem::vector<int> payload(10, &m_resource);
+    vecmem::vector<unsigned int> sizes = {{5u, 7u}, &m_resource};
+    vecmem::data::vector_view<int> views[] = {
+        {5u, &(sizes[1]), payload.data()},
+        {5u, &(sizes[0]), payload.data() + 5}};
+    copy.m_memsets = 0;
+    copy.setup(vecmem::data::jagged_vector_view<int>(2u, views))->wait();
+    EXPECT_EQ(copy.m_memsets, 2u);
+    EXPECT_EQ(sizes[0], 0u);
+    EXPECT_EQ(sizes[1], 0u);
+}
+
+/// Tests for copying jagged vectors that had too many elements added to them
+TEST_F(core_copy_test, overflowing_jagged_vector_buffer) {
+
+    // Create a resizable jagged buffer.
+    vecmem::data::jagged_vector_buffer<int> buffer({0, 0, 0}, {2, 3, 4},
+                                                   m_resource);
+    m_copy.setup(buffer)->wait();
+
+    // Add more elements to some of its rows than what they can hold.
+    vecmem::jagged_device_vector<int> device(buffer);
+    for (int i = 0; i < 5; ++i) {
+        device[0].push_back(i);
+    }
+    for (int i = 0; i < 3; ++i) {
+        device[2].push_back(i);
+    }
+    EXPECT_TRUE(device[0].overflowed());
+    EXPECT_FALSE(device[2].overflowed());
+
+    // The requested sizes can be read back, but copies only handle the
+    // elements that fit into the rows.
+    EXPECT_EQ(m_copy.get_sizes(buffer),
+              (std::vector<unsigned int>{5u, 0u, 3u}));
+    vecmem::jagged_vector<int> host(&m_resource);
+    m_copy(buffer, host)->wait();
+    ASSERT_EQ(host.size(), 3u);
+    EXPECT_EQ(host[0].size(), 2u);
+    EXPECT_EQ(host[1].size(), 0u);
+    EXPECT_EQ(host[2].size(), 3u);
+    EXPECT_EQ(host[0][1], 1);
+    EXPECT_EQ(host[2][2], 2);
+}
+
+/// Tests for copying overflowed buffers into larger targets
+TEST_F(core_copy_test, overflowing_buffers_into_larger_targets) {
+
+    // Create overflowed 1D and jagged buffers.
+    vecmem::data::vector_buffer<int> source1(5, 0, m_resource);
+    m_copy.setup(source1)->wait();
+    vecmem::device_vector<int> device1(source1);
+    for (int i = 0; i < 12; ++i) {
+        device1.push_back(i);
+    }
+    vecmem::data::jagged_vector_buffer<int> source2({0, 0, 0}, {2, 3, 4},
+                                                    m_resource);
+    m_copy.setup(source2)->wait();
+    vecmem::jagged_device_vector<int> device2(source2);
+    for (int i = 0; i < 3; ++i) {
+        device2[0].push_back(i);
+        device2[2].push_back(i);
+    }
+
+    // Copy the 1D buffer into a re-used, larger buffer.
+    vecmem::data::vector_buffer<int> target1(20, 0, m_resource);
+    m_copy.setup(target1)->wait();
+    counting_copy copy;
+    copy.to(source1, target1, m_resource, vecmem::copy::type::host_to_host)
+        ->wait();
+    EXPECT_EQ(target1.capacity(), 20u);
+    EXPECT_EQ(m_copy.get_size(target1), 5u);
+    std::vector<int> result;
+    m_copy(target1, result)->wait();
+    EXPECT_EQ(result, std::vector<int>({0, 1, 2, 3, 4}));
+    // Only the stored elements are copied. With the size of the source
+    // read with a copy, and the size of the (host) buffer set directly.
+    EXPECT_EQ(copy.m_copies, 2u);
+    EXPECT_EQ(copy.m_bytes, sizeof(unsigned int) + 5 * sizeof(int));
+
+    // Copy the buffers into larger targets with a plan.
+    vecmem::data::vector_buffer<int> target2(20, 0, m_resource);
+    m_copy.setup(target2)->wait();
+    vecmem::data::jagged_vector_buffer<int> target3({0, 0, 0}, {4, 4, 4},
+                                                    m_resource);
+    m_copy.setup(target3)->wait();
+    vecmem::copy_plan plan;
+    plan.add(source1, target2);
+    plan.add(source2, target3);
+    m_copy(plan)->wait();
+    EXPECT_EQ(m_copy.get_size(target2), 5u);
+    EXPECT_EQ(m_copy.get_sizes(target3),
+              (std::vector<unsigned int>{2u, 0u, 3u}));
+    m_copy(target2, result)->wait();
+    EXPECT_EQ(result, std::vector<int>({0, 1, 2, 3, 4}));
+
+    // Targets with the same capacities receive the sizes as they are.
+    vecmem::data::vector_buffer<int> target4(5, 0, m_resource);
+    m_copy.setup(target4)->wait();
+    vecmem::copy_plan plan2;
+    plan2.add(source1, target4);
+    m_copy(plan2)->wait();
+    EXPECT_EQ(m_copy.get_size(target4), 12u);
+    m_copy(target4, result)->wait();
+    EXPECT_EQ(result, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+/// Tests for compacting resizable jagged vector buffers
+TEST_F(core_copy_test, compact_jagged_vector_buffer) {
+
+    // Create a resizable jagged buffer, and fill it partially.
+    vecmem::data::jagged_vector_buffer<int> buffer({0, 0, 0, 0}, {5, 5, 5, 5},
+                                                   m_resource);
+    m_copy.setup(buffer)->wait();
+    vecmem::jagged_device_vector<int> device(buffer);
+    for (int i = 0; i < 3; ++i) {
+        device[0].push_back(i);
+    }
+    for (int i = 0; i < 7; ++i) {
+        device[3].push_back(10 + i);
+    }
+    device[2].push_back(20);
+
+    // Compact it into a tight buffer.
+    vecmem::data::jagged_vector_buffer<int> compact =
+        m_copy.compact(vecmem::get_data(buffer), m_resource);
+    ASSERT_EQ(compact.size(), 4u);
+    const std::vector<unsigned int> sizes = {3u, 0u, 1u, 5u};
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        EXPECT_EQ(compact.host_ptr()[i].size_ptr(), nullptr);
+        EXPECT_EQ(compact.host_ptr()[i].capacity(), sizes[i]);
+        if (i + 1 < sizes.size()) {
+            EXPECT_EQ(compact.host_ptr()[i].ptr() + sizes[i],
+                      compact.host_ptr()[i + 1].ptr());
+        }
+    }
+
+    // Check its contents.
+    vecmem::jagged_vector<int> host(&m_resource);
+    m_copy(compact, host)->wait();
+    EXPECT_EQ(host[0], (vecmem::vector<int>{0, 1, 2}));
+    EXPECT_TRUE(host[1].empty());
+    EXPECT_EQ(host[2], (vecmem::vector<int>{20}));
+    EXPECT_EQ(host[3], (vecmem::vector<int>{10, 11, 12, 13, 14}));
+}
@@ -0,0 +1,168 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/event_awaitable.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+#include "vecmem/utils/host_event.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+// System include(s).
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/// Minimal, eagerly started coroutine type, signalling its completion
+struct task {
+    struct promise_type {
+        std::promise<void> m_done;
+        task get_return_object() { return {m_done.get_future()}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { m_done.set_value(); }
+        void unhandled_exception() {
+            m_done.set_exception(std::current_exception());
+        }
+    };  // struct promise_type
+    std::future<void> m_done;
+};  // struct task
+
+/// Event that has to be polled, like the events of the device backends
+struct flag_event : public vecmem::abstract_event {
+    flag_event(std::shared_ptr<std::atomic<bool> > flag) : m_flag(flag) {}
+    void wait() override {
+        while (!is_ready()) {
+            std::this_thread::yield();
+        }
+    }
+    bool is_ready() override { return m_flag->load(); }
+    std::shared_ptr<std::atomic<bool> > m_flag;
+};  // struct flag_event
+
+/// Coroutine awaiting an event, setting a flag once resumed
+task await_event(vecmem::event_ptr event, std::atomic<bool>& resumed) {
+    co_await std::move(event);
+    resumed = true;
+}
+
+/// Coroutine copying one vector into another
+task copy_vector(const vecmem::copy& copy, vecmem::vector<int>& from,
+                 vecmem::vector<int>& to, std::atomic<bool>& resumed) {
+    co_await copy(vecmem::get_data(from), vecmem::get_data(to));
+    resumed = true;
+}
+
+/// Coroutine awaiting an event, and recording the thread it resumed on
+task await_on_pool(vecmem::event_ptr event, vecmem::thread_pool& pool,
+                   std::thread::id& resumed_id) {
+    co_await vecmem::resume_on(std::move(event), pool);
+    resumed_id = std::this_thread::get_id();
+}
+
+}  // namespace
+
+/// Test awaiting asynchronous copies
+TEST(core_coroutine_test, copy) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::thread_pool pool(1);
+    vecmem::host::async_copy::config cfg;
+    cfg.sync_threshold = 0;
+    vecmem::host::async_copy copy(pool, cfg);
+
+    static constexpr unsigned int SIZE = 10000;
+    vecmem::vector<int> a(SIZE, &resource), b(SIZE, &resource);
+    std::iota(a.begin(), a.end(), 0);
+
+    // Block the pool, so that the copy would not finish right away.
+    std::promise<void> block;
+    std::shared_future<void> blocked = block.get_future().share();
+    pool.submit([blocked]() { blocked.wait(); });
+
+    std::atomic<bool> resumed{false};
+    task t = copy_vector(copy, a, b, resumed);
+    EXPECT_FALSE(resumed.load());
+
+    block.set_value();
+    t.m_done.get();
+    EXPECT_TRUE(resumed.load());
+    EXPECT_EQ(a, b);
+}
+
+/// Test awaiting events that need to be polled
+TEST(core_coroutine_test, polled_event) {
+
+    auto flag = std::make_shared<std::atomic<bool> >(false);
+    std::atomic<bool> resumed{false};
+    task t = await_event(std::make_unique<flag_event>(flag), resumed);
+    EXPECT_FALSE(resumed.load());
+
+    flag->store(true);
+    t.m_done.get();
+    EXPECT_TRUE(resumed.load());
+}
+
+/// Test awaiting events that are already complete
+TEST(core_coroutine_test, ready_event) {
+
+    vecmem::host_event event;
+    event.complete();
+    std::atomic<bool> resumed{false};
+    task t = await_event(std::make_unique<vecmem::host_event>(event), resumed);
+    EXPECT_TRUE(resumed.load());
+    t.m_done.get();
+}
+
+/// Test the propagation of errors
+TEST(core_coroutine_test, error) {
+
+    vecmem::host_event event;
+    std::atomic<bool> resumed{false};
+    task t = await_event(std::make_unique<vecmem::host_event>(event), resumed);
+    event.complete(std::make_exception_ptr(std::runtime_error("failure")));
+    EXPECT_THROW(t.m_done.get(), std::runtime_error);
+    EXPECT_FALSE(resumed.load());
+}
+
+/// Test resuming coroutines on a thread pool
+TEST(core_coroutine_test, resume_on) {
+
+    vecmem::thread_pool pool(1);
+    std::promise<std::thread::id> worker;
+    pool.submit([&worker]() { worker.set_value(std::this_thread::get_id()); });
+    const std::thread::id worker_id = worker.get_future().get();
+
+    vecmem::host_event event;
+    std::thread::id resumed_id;
+    task t = await_on_pool(std::make_unique<vecmem::host_event>(event), pool,
+                           resumed_id);
+    event.complete();
+    t.m_done.get();
+    EXPECT_EQ(resumed_id, worker_id);
+}
+
+#else
+
+/// Dummy test for compilers without coroutine support
+TEST(core_coroutine_test, unavailable) {
+    GTEST_SKIP() << "C++20 coroutines are not available";
+}
+
+#endif  // __cpp_impl_coroutine
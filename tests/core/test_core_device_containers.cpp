@@ -17,6 +17,7 @@
 #include "vecmem/memory/contiguous_memory_resource.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
 #include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/thread_pool.hpp"
 
 // GoogleTest include(s).
 #include <gtest/gtest.h>
@@ -24,6 +25,7 @@
 // System include(s).
 #include <cstring>
 #include <type_traits>
+#include <vector>
 
 /// Test case for the custom device container types
 class core_device_container_test : public testing::Test {
@@ -130,6 +132,47 @@ TEST_F(core_device_container_test, jagged_vector_buffer) {
     }
 }
 
+/// Test(s) for setting up @c vecmem::data::jagged_vector_buffer from a view
+TEST_F(core_device_container_test, jagged_vector_buffer_from_view) {
+
+    // Sizes for the buffers, in a view, as if they were counted by a
+    // previous processing step.
+    vecmem::vector<unsigned int> sizes(100000, &m_resource);
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        sizes[i] = static_cast<unsigned int>(i % 7);
+    }
+    auto sizes_data = vecmem::get_data(sizes);
+
+    // Set up the buffers with and without a thread pool.
+    vecmem::thread_pool pool(3);
+    vecmem::contiguous_memory_resource cresource(m_resource, 4000000);
+    vecmem::data::jagged_vector_buffer<int> buffer1(sizes_data, m_resource);
+    vecmem::data::jagged_vector_buffer<int> buffer2(sizes_data, m_resource,
+                                                    &cresource, &pool);
+
+    // Test the internal state of the buffers.
+    EXPECT_EQ(buffer1.ptr(), buffer1.host_ptr());
+    EXPECT_NE(buffer2.ptr(), buffer2.host_ptr());
+    ASSERT_EQ(buffer1.size(), sizes.size());
+    ASSERT_EQ(buffer2.size(), sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        EXPECT_EQ(buffer1.host_ptr()[i].size(), sizes[i]);
+        EXPECT_EQ(buffer2.host_ptr()[i].size(), sizes[i]);
+    }
+    for (std::size_t i = 0; i < sizes.size() - 1; ++i) {
+        EXPECT_EQ(buffer1.host_ptr()[i].ptr() + sizes[i],
+                  buffer1.host_ptr()[i + 1].ptr());
+        EXPECT_EQ(buffer2.host_ptr()[i].ptr() + sizes[i],
+                  buffer2.host_ptr()[i + 1].ptr());
+    }
+
+    // Make sure that an empty view works as well.
+    vecmem::data::jagged_vector_buffer<int> buffer3(
+        vecmem::data::vector_view<const unsigned int>(0, nullptr), m_resource,
+        nullptr, &pool);
+    EXPECT_EQ(buffer3.size(), 0u);
+}
+
 /// Test(s) for a "resizable" @c vecmem::data::vector_buffer
 TEST_F(core_device_container_test, resizable_vector_buffer) {
 
@@ -207,6 +250,19 @@ TEST_F(core_device_container_test, resizable_vector_buffer) {
         EXPECT_EQ(device_vector[i], 234);
     }
 
+    EXPECT_EQ(device_vector.bulk_append(3), static_cast<vector_size_type>(24));
+    EXPECT_EQ(device_vector.size(), static_cast<vector_size_type>(27));
+    for (vector_size_type i = 24; i < 27; ++i) {
+        device_vector[i] = 345;
+    }
+    EXPECT_EQ(device_vector.bulk_append(5, 456),
+              static_cast<vector_size_type>(27));
+    EXPECT_EQ(device_vector.size(), static_cast<vector_size_type>(32));
+    for (vector_size_type i = 27; i < 32; ++i) {
+        EXPECT_EQ(device_vector[i], 456);
+    }
+    device_vector.resize(24);
+
     // Copy the modified data back into the "host vector", and check if that
     // succeeded.
     m_copy(resizable_buffer, host_vector);
@@ -281,6 +337,55 @@ TEST_F(core_device_container_test, resizable_jagged_vector_buffer) {
     EXPECT_EQ(device_vec.at(9).capacity(), 2u);
 }
 
+/// Test adding more elements to a resizable vector than what it can hold.
+TEST_F(core_device_container_test, overflowing_vector_buffer) {
+
+    // Create a small resizable buffer.
+    vecmem::data::vector_buffer<int> buffer(5, 0, m_resource);
+    m_copy.setup(buffer)->wait();
+    vecmem::device_vector<int> device_vec(buffer);
+
+    // Add more elements to it than what it can hold.
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(device_vec.push_back(i), static_cast<unsigned int>(i));
+    }
+    EXPECT_EQ(device_vec.bulk_append(4, 10), 8u);
+    EXPECT_TRUE(device_vec.overflowed());
+    EXPECT_EQ(device_vec.requested_size(), 12u);
+    EXPECT_EQ(device_vec.size(), 5u);
+    EXPECT_EQ(buffer.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(device_vec[i], i);
+    }
+
+    // The host can read back the number of requested elements.
+    EXPECT_EQ(m_copy.get_size(buffer), 12u);
+
+    // But copies only handle the elements that fit into the buffer.
+    std::vector<int> host_vec;
+    m_copy(buffer, host_vec)->wait();
+    EXPECT_EQ(host_vec.size(), 5u);
+    vecmem::data::vector_buffer<int> target(5, 0, m_resource);
+    m_copy.setup(target)->wait();
+    m_copy(buffer, target)->wait();
+    EXPECT_EQ(m_copy.get_size(target), 5u);
+
+    // Removing elements from an overflowed vector only touches the elements
+    // that are actually in it.
+    EXPECT_EQ(device_vec.pop_back(), 11u);
+    EXPECT_EQ(device_vec.pop_back(), 10u);
+    EXPECT_EQ(device_vec.requested_size(), 10u);
+    EXPECT_TRUE(device_vec.overflowed());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(device_vec[i], i);
+    }
+
+    // Clearing the vector makes it usable again.
+    device_vec.clear();
+    EXPECT_FALSE(device_vec.overflowed());
+    EXPECT_EQ(device_vec.push_back(1), 0u);
+}
+
 /// Tests with converting between compatible types.
 TEST_F(core_device_container_test, conversions) {
 
@@ -0,0 +1,243 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/event_composition.hpp"
+#include "vecmem/utils/host_event.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Event that has to be polled, like the events of the device backends
+struct flag_event : public vecmem::abstract_event {
+    flag_event(std::shared_ptr<std::atomic<bool> > flag) : m_flag(flag) {}
+    void wait() override {
+        while (!is_ready()) {
+            std::this_thread::yield();
+        }
+    }
+    bool is_ready() override { return m_flag->load(); }
+    std::shared_ptr<std::atomic<bool> > m_flag;
+};  // struct flag_event
+
+/// Event only implementing the blocking part of the interface
+struct blocking_event : public vecmem::abstract_event {
+    void wait() override { ++m_waits; }
+    int m_waits = 0;
+};  // struct blocking_event
+
+/// Helper function creating a handle to a host event
+vecmem::event_ptr make_ptr(const vecmem::host_event& event) {
+    return std::make_unique<vecmem::host_event>(event);
+}
+
+}  // namespace
+
+/// Test the basic behaviour of host events
+TEST(core_event_composition_test, host_event) {
+
+    vecmem::host_event event;
+    EXPECT_FALSE(event.is_ready());
+
+    int calls = 0;
+    event.then([&calls]() { ++calls; });
+    EXPECT_EQ(calls, 0);
+
+    // Complete the event from a different thread.
+    vecmem::event_ptr handle = make_ptr(event);
+    std::thread thread([event]() { event.complete(); });
+    handle->wait();
+    thread.join();
+    EXPECT_TRUE(handle->is_ready());
+    EXPECT_EQ(calls, 1);
+
+    // Callbacks attached to complete events should run right away.
+    event.then([&calls]() { ++calls; });
+    EXPECT_EQ(calls, 2);
+
+    // Completing the event again should have no effect.
+    event.complete();
+    EXPECT_EQ(calls, 2);
+
+    // Errors should be re-thrown by wait().
+    vecmem::host_event failed;
+    failed.complete(std::make_exception_ptr(std::runtime_error("failure")));
+    EXPECT_TRUE(failed.is_ready());
+    EXPECT_THROW(failed.wait(), std::runtime_error);
+}
+
+/// Test combining host events
+TEST(core_event_composition_test, host_all_any) {
+
+    std::vector<vecmem::host_event> events(3);
+    std::vector<vecmem::event_ptr> all_inputs, any_inputs;
+    for (const vecmem::host_event& event : events) {
+        all_inputs.push_back(make_ptr(event));
+        any_inputs.push_back(make_ptr(event));
+    }
+    vecmem::event_ptr all = vecmem::when_all(std::move(all_inputs));
+    vecmem::event_ptr any = vecmem::when_any(std::move(any_inputs));
+    EXPECT_FALSE(all->is_ready());
+    EXPECT_FALSE(any->is_ready());
+
+    events[1].complete();
+    EXPECT_FALSE(all->is_ready());
+    EXPECT_TRUE(any->is_ready());
+    events[0].complete();
+    events[2].complete(std::make_exception_ptr(std::runtime_error("fail")));
+    EXPECT_TRUE(all->is_ready());
+    EXPECT_THROW(all->wait(), std::runtime_error);
+    EXPECT_NO_THROW(any->wait());
+
+    // Test the trivial cases.
+    EXPECT_TRUE(vecmem::when_all({})->is_ready());
+    EXPECT_THROW(vecmem::when_any({}), std::invalid_argument);
+}
+
+/// Test combining generic events
+TEST(core_event_composition_test, generic_all_any) {
+
+    std::vector<std::shared_ptr<std::atomic<bool> > > flags;
+    std::vector<vecmem::event_ptr> all_inputs, any_inputs;
+    for (int i = 0; i < 3; ++i) {
+        flags.push_back(std::make_shared<std::atomic<bool> >(false));
+        all_inputs.push_back(std::make_unique<flag_event>(flags.back()));
+        any_inputs.push_back(std::make_unique<flag_event>(flags.back()));
+    }
+    // Mix in a host event as well.
+    vecmem::host_event host;
+    all_inputs.push_back(make_ptr(host));
+    any_inputs.push_back(make_ptr(host));
+
+    vecmem::event_ptr all = vecmem::when_all(std::move(all_inputs));
+    vecmem::event_ptr any = vecmem::when_any(std::move(any_inputs));
+    EXPECT_FALSE(all->is_ready());
+    EXPECT_FALSE(any->is_ready());
+
+    std::thread thread([&flags]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        flags[2]->store(true);
+    });
+    any->wait();
+    thread.join();
+    EXPECT_FALSE(all->is_ready());
+
+    for (auto& flag : flags) {
+        flag->store(true);
+    }
+    host.complete();
+    EXPECT_TRUE(all->is_ready());
+    all->wait();
+}
+
+/// Test the default readiness check of events
+TEST(core_event_composition_test, default_is_ready) {
+
+    blocking_event event;
+    EXPECT_TRUE(event.is_ready());
+    EXPECT_EQ(event.m_waits, 1);
+
+    std::vector<vecmem::event_ptr> inputs;
+    inputs.push_back(std::make_unique<blocking_event>());
+    vecmem::event_ptr all = vecmem::when_all(std::move(inputs));
+    EXPECT_TRUE(all->is_ready());
+    all->wait();
+}
+
+/// Test running callbacks on a thread pool
+TEST(core_event_composition_test, then) {
+
+    vecmem::thread_pool pool(2);
+
+    // Callback on a host event.
+    std::atomic<int> calls{0};
+    vecmem::host_event host;
+    vecmem::event_ptr after_host =
+        vecmem::then(make_ptr(host), [&calls]() { ++calls; }, pool);
+    EXPECT_FALSE(after_host->is_ready());
+    host.complete();
+    after_host->wait();
+    EXPECT_EQ(calls.load(), 1);
+
+    // Callback on a generic event.
+    auto flag = std::make_shared<std::atomic<bool> >(false);
+    vecmem::event_ptr after_flag = vecmem::then(
+        std::make_unique<flag_event>(flag), [&calls]() { ++calls; }, pool);
+    flag->store(true);
+    after_flag->wait();
+    EXPECT_EQ(calls.load(), 2);
+
+    // Errors of the callback and of the input event should be propagated.
+    vecmem::host_event done;
+    done.complete();
+    vecmem::event_ptr throwing = vecmem::then(
+        make_ptr(done), []() { throw std::runtime_error("callback"); },
+        pool);
+    EXPECT_THROW(throwing->wait(), std::runtime_error);
+
+    vecmem::host_event failed;
+    failed.complete(std::make_exception_ptr(std::logic_error("input")));
+    vecmem::event_ptr skipped =
+        vecmem::then(make_ptr(failed), [&calls]() { ++calls; }, pool);
+    EXPECT_THROW(skipped->wait(), std::logic_error);
+    EXPECT_EQ(calls.load(), 2);
+
+    // Pending generic events should not block the workers of the pool.
+    vecmem::thread_pool small_pool(1);
+    auto pending = std::make_shared<std::atomic<bool> >(false);
+    std::vector<vecmem::event_ptr> waiting;
+    for (int i = 0; i < 3; ++i) {
+        waiting.push_back(vecmem::then(std::make_unique<flag_event>(pending),
+                                       [&calls]() { ++calls; }, small_pool));
+    }
+    std::promise<void> promise;
+    small_pool.submit([&promise]() { promise.set_value(); });
+    EXPECT_EQ(promise.get_future().wait_for(std::chrono::seconds(10)),
+              std::future_status::ready);
+    EXPECT_EQ(calls.load(), 2);
+    pending->store(true);
+    for (vecmem::event_ptr& event : waiting) {
+        event->wait();
+    }
+    EXPECT_EQ(calls.load(), 5);
+}
+
+/// Test getting notified about the completion of events
+TEST(core_event_composition_test, on_ready) {
+
+    // Notification about a host event.
+    std::atomic<int> calls{0};
+    vecmem::host_event host;
+    vecmem::on_ready(host, [&calls]() { ++calls; });
+    EXPECT_EQ(calls.load(), 0);
+    host.complete();
+    EXPECT_EQ(calls.load(), 1);
+
+    // Notification about a polled event.
+    auto flag = std::make_shared<std::atomic<bool> >(false);
+    flag_event polled(flag);
+    std::promise<void> notified;
+    vecmem::on_ready(polled, [&notified]() { notified.set_value(); });
+    flag->store(true);
+    notified.get_future().wait();
+
+    // Notification about a complete event.
+    vecmem::on_ready(polled, [&calls]() { ++calls; });
+    EXPECT_EQ(calls.load(), 2);
+}
@@ -0,0 +1,129 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/event_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Event counting its own instances
+struct counted_event : public vecmem::abstract_event {
+    counted_event() { ++s_instances; }
+    ~counted_event() { --s_instances; }
+    void wait() override {}
+    bool is_ready() override { return true; }
+    static int s_instances;
+};  // struct counted_event
+
+int counted_event::s_instances = 0;
+
+/// Copy object exposing its events
+struct event_copy : public vecmem::copy {
+    event_type make_event() const { return create_event(); }
+};  // struct event_copy
+
+}  // namespace
+
+/// Test that plain (non-pooled) events are deleted
+TEST(core_event_pool_test, plain) {
+
+    {
+        vecmem::event_ptr event = std::make_unique<counted_event>();
+        EXPECT_EQ(counted_event::s_instances, 1);
+    }
+    EXPECT_EQ(counted_event::s_instances, 0);
+}
+
+/// Test the recycling of events
+TEST(core_event_pool_test, recycle) {
+
+    auto pool = std::make_shared<vecmem::event_pool>(2);
+    EXPECT_EQ(pool->acquire(), nullptr);
+
+    // Hand out a few events, and release them.
+    std::vector<vecmem::event_ptr> events;
+    for (int i = 0; i < 3; ++i) {
+        events.push_back(
+            pool->make_pooled(std::make_unique<counted_event>()));
+    }
+    EXPECT_EQ(counted_event::s_instances, 3);
+    events.clear();
+
+    // Only as many events should have been kept, as the pool allows.
+    EXPECT_EQ(pool->size(), 2u);
+    EXPECT_EQ(counted_event::s_instances, 2);
+
+    // The kept events should be handed out again.
+    std::unique_ptr<vecmem::abstract_event> event = pool->acquire();
+    ASSERT_NE(event, nullptr);
+    vecmem::abstract_event* recycled = event.get();
+    EXPECT_EQ(pool->size(), 1u);
+    pool->make_pooled(std::move(event)).reset();
+    EXPECT_EQ(pool->size(), 2u);
+    event = pool->acquire();
+    EXPECT_EQ(event.get(), recycled);
+    event.reset();
+    EXPECT_EQ(counted_event::s_instances, 1);
+
+    // Events should be able to outlive the object that created them.
+    {
+        vecmem::event_ptr pooled =
+            pool->make_pooled(std::make_unique<counted_event>());
+        pool.reset();
+        EXPECT_EQ(counted_event::s_instances, 2);
+        pooled->wait();
+    }
+    EXPECT_EQ(counted_event::s_instances, 0);
+}
+
+/// Test the thread safety of the pool
+TEST(core_event_pool_test, threads) {
+
+    auto pool = std::make_shared<vecmem::event_pool>(4);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([pool]() {
+            for (int j = 0; j < 1000; ++j) {
+                std::unique_ptr<vecmem::abstract_event> event =
+                    pool->acquire();
+                if (!event) {
+                    event = std::make_unique<counted_event>();
+                }
+                pool->make_pooled(std::move(event))->wait();
+            }
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    EXPECT_LE(pool->size(), 4u);
+    EXPECT_EQ(counted_event::s_instances, static_cast<int>(pool->size()));
+    pool.reset();
+    EXPECT_EQ(counted_event::s_instances, 0);
+}
+
+/// Test that the host copy's events do not need to be allocated
+TEST(core_event_pool_test, noop) {
+
+    event_copy copy;
+    vecmem::copy::event_type event1 = copy.make_event();
+    vecmem::copy::event_type event2 = copy.make_event();
+    EXPECT_EQ(event1.get(), event2.get());
+    event1->wait();
+    event1.reset();
+    event2->wait();
+}
@@ -0,0 +1,140 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/flat_jagged_vector.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+/// Copy object counting the "low level" copies that it performs
+class counting_copy : public vecmem::copy {
+
+public:
+    /// The number of @c do_copy calls made
+    mutable std::size_t m_copies = 0;
+
+protected:
+    void do_copy(std::size_t size, const void* from, void* to,
+                 type::copy_type cptype) const override {
+        ++m_copies;
+        vecmem::copy::do_copy(size, from, to, cptype);
+    }
+
+};  // class counting_copy
+
+}  // namespace
+
+/// Test case for @c vecmem::flat_jagged_vector
+class core_flat_jagged_vector_test : public testing::Test {
+
+protected:
+    /// Fill a container with some reference values
+    static void fill(vecmem::flat_jagged_vector<int>& vec) {
+        vec.push_back({1, 2, 3});
+        vec.push_back({});
+        const std::vector<int> row = {4, 5};
+        vec.push_back(row.begin(), row.end());
+        vec.add_row();
+        for (int i = 6; i < 10; ++i) {
+            vec.add_to_last_row(i);
+        }
+    }
+
+    /// Memory resource for the test(s)
+    vecmem::host_memory_resource m_resource;
+    /// Copy object for the test(s)
+    counting_copy m_copy;
+
+};  // class core_flat_jagged_vector_test
+
+/// Tests for filling and accessing the container
+TEST_F(core_flat_jagged_vector_test, fill) {
+
+    vecmem::flat_jagged_vector<int> vec(m_resource);
+    EXPECT_TRUE(vec.empty());
+    fill(vec);
+
+    EXPECT_EQ(vec.size(), 4u);
+    EXPECT_EQ(vec.total_size(), 9u);
+    const std::vector<unsigned int> offsets = {0u, 3u, 3u, 5u, 9u};
+    EXPECT_TRUE(std::equal(offsets.begin(), offsets.end(),
+                           vec.offsets().begin(), vec.offsets().end()));
+    EXPECT_EQ(vec[0].size(), 3u);
+    EXPECT_TRUE(vec[1].empty());
+    EXPECT_EQ(vec[2][1], 5);
+    vec[3][0] = 60;
+    const vecmem::flat_jagged_vector<int>& cvec = vec;
+    EXPECT_EQ(cvec[3][0], 60);
+    int sum = 0;
+    for (int value : cvec[3]) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 60 + 7 + 8 + 9);
+
+    // Set up the container from row sizes.
+    vec.resize({2, 0, 1});
+    EXPECT_EQ(vec.size(), 3u);
+    EXPECT_EQ(vec.total_size(), 3u);
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.total_size(), 0u);
+}
+
+/// Tests for the views of the container
+TEST_F(core_flat_jagged_vector_test, data) {
+
+    vecmem::flat_jagged_vector<int> vec(m_resource);
+    fill(vec);
+
+    // The rows of the view must be right after each other in memory.
+    auto data = vecmem::get_data(vec);
+    ASSERT_EQ(data.size(), 4u);
+    for (std::size_t i = 0; i + 1 < data.size(); ++i) {
+        EXPECT_EQ(data.host_ptr()[i].ptr() + data.host_ptr()[i].capacity(),
+                  data.host_ptr()[i + 1].ptr());
+    }
+
+    // Access it through a device vector.
+    const auto cdata = vecmem::get_data(
+        static_cast<const vecmem::flat_jagged_vector<int>&>(vec));
+    vecmem::jagged_device_vector<const int> device(cdata);
+    EXPECT_EQ(device.size(), 4u);
+    EXPECT_EQ(device[2][0], 4);
+    EXPECT_EQ(device[3].size(), 4u);
+}
+
+/// Tests for copying the container
+TEST_F(core_flat_jagged_vector_test, copy) {
+
+    vecmem::flat_jagged_vector<int> vec(m_resource);
+    fill(vec);
+
+    // Copying the container into a buffer needs a single memory copy.
+    auto data = vecmem::get_data(vec);
+    vecmem::data::jagged_vector_buffer<int> buffer(data, m_resource);
+    m_copy.setup(buffer)->wait();
+    m_copy(data, buffer)->wait();
+    EXPECT_EQ(m_copy.m_copies, 1u);
+
+    // Copy it back into a new container.
+    vecmem::flat_jagged_vector<int> result(m_resource);
+    m_copy(buffer, result)->wait();
+    EXPECT_EQ(result.offsets(), vec.offsets());
+    EXPECT_EQ(result.values(), vec.values());
+}
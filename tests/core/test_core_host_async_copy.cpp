@@ -0,0 +1,217 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/event_composition.hpp"
+#include "vecmem/utils/host/async_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <vector>
+
+/// Test case for testing @c vecmem::host::async_copy
+class core_host_async_copy_test : public testing::Test {
+
+protected:
+    /// Configuration making even small copies run asynchronously
+    static vecmem::host::async_copy::config small_threshold() {
+        vecmem::host::async_copy::config cfg;
+        cfg.sync_threshold = 64;
+        return cfg;
+    }
+
+    /// Block the (single) worker of the test's thread pool
+    ///
+    /// @return The promise to fulfill to release the worker
+    ///
+    std::shared_ptr<std::promise<void> > block_pool() {
+        auto promise = std::make_shared<std::promise<void> >();
+        std::shared_future<void> future = promise->get_future().share();
+        m_pool.submit([future]() { future.wait(); });
+        return promise;
+    }
+
+    /// Memory resource for the test(s)
+    vecmem::host_memory_resource m_resource;
+    /// Thread pool for the test(s)
+    vecmem::thread_pool m_pool{1};
+    /// Copy object for the test(s)
+    vecmem::host::async_copy m_copy{m_pool, small_threshold()};
+
+};  // class core_host_async_copy_test
+
+/// Tests for the configuration of the copy object
+TEST_F(core_host_async_copy_test, config) {
+
+    EXPECT_EQ(m_copy.get_config().sync_threshold, 64u);
+
+    vecmem::host::async_copy copy;
+    EXPECT_EQ(copy.get_config().sync_threshold,
+              vecmem::host::async_copy::config{}.sync_threshold);
+}
+
+/// Tests for copying 1-dimensional vectors
+TEST_F(core_host_async_copy_test, vector) {
+
+    for (std::size_t size : {3u, 200u, 100003u}) {
+
+        // Create a reference vector.
+        vecmem::vector<int> reference(size, &m_resource);
+        std::iota(reference.begin(), reference.end(), 0);
+
+        // Copy it into a resizable buffer, and back into a vector.
+        vecmem::data::vector_buffer<int> buffer(
+            static_cast<unsigned int>(size), 0u, m_resource);
+        m_copy.setup(buffer)->wait();
+        m_copy(vecmem::get_data(reference), buffer)->wait();
+        vecmem::vector<int> result(&m_resource);
+        m_copy(buffer, result)->wait();
+
+        // Compare them.
+        EXPECT_EQ(reference, result);
+    }
+}
+
+/// Tests for copying jagged vectors
+TEST_F(core_host_async_copy_test, jagged_vector) {
+
+    // Create a reference jagged vector, with inner vectors of varying sizes.
+    vecmem::jagged_vector<int> reference(&m_resource);
+    for (std::size_t i = 0; i < 20; ++i) {
+        reference.emplace_back(i * 137);
+        std::iota(reference.back().begin(), reference.back().end(),
+                  static_cast<int>(i));
+    }
+
+    // Copy it into a buffer, and back into a jagged vector.
+    vecmem::data::jagged_vector_buffer<int> buffer =
+        m_copy.to(vecmem::get_data(reference), m_resource);
+    vecmem::jagged_vector<int> result(&m_resource);
+    m_copy(buffer, result)->wait();
+
+    // Compare them.
+    EXPECT_EQ(reference, result);
+}
+
+/// Tests for batches of many small copies, which are large in total
+TEST_F(core_host_async_copy_test, small_segment_batch) {
+
+    // Create a jagged vector with lots of small inner vectors. Using more
+    // than 64 kB of payload in total.
+    static constexpr std::size_t SIZE = 17000;
+    vecmem::jagged_vector<int> reference(&m_resource);
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        reference.push_back({static_cast<int>(i)});
+    }
+
+    // Copy it into a resizable buffer, with the default configuration. The
+    // payload is copied with a batch of small copies.
+    vecmem::host::async_copy copy(1);
+    vecmem::data::jagged_vector_buffer<int> buffer(
+        std::vector<std::size_t>(SIZE, 0), std::vector<std::size_t>(SIZE, 1),
+        m_resource);
+    copy.setup(buffer)->wait();
+    copy(vecmem::get_data(reference), buffer)->wait();
+
+    // Check the result.
+    vecmem::jagged_vector<int> result(&m_resource);
+    copy(buffer, result)->wait();
+    EXPECT_EQ(reference, result);
+}
+
+/// Tests for copies that need to use temporary buffers internally
+TEST_F(core_host_async_copy_test, temporary_sources) {
+
+    // Create a fixed size jagged buffer with lots of rows. So that its
+    // sizes would take up more than 64 kB.
+    static constexpr std::size_t SIZE = 40000;
+    vecmem::jagged_vector<int> reference(&m_resource);
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        reference.push_back({static_cast<int>(i)});
+    }
+    vecmem::data::jagged_vector_buffer<int> source(
+        std::vector<std::size_t>(SIZE, 1), m_resource);
+    m_copy(vecmem::get_data(reference), source)->wait();
+
+    // Copy it into a resizable buffer while the pool is busy. The sizes of
+    // the target are set from a temporary buffer, which is gone by the time
+    // the copy is executed.
+    vecmem::data::jagged_vector_buffer<int> target(
+        std::vector<std::size_t>(SIZE, 0), std::vector<std::size_t>(SIZE, 2),
+        m_resource);
+    m_copy.setup(target)->wait();
+    auto promise = block_pool();
+    vecmem::copy::event_type event = m_copy(source, target);
+    promise->set_value();
+    event->wait();
+
+    // Check the result.
+    vecmem::jagged_vector<int> result(&m_resource);
+    m_copy(target, result)->wait();
+    EXPECT_EQ(reference, result);
+}
+
+/// Tests for the asynchronous, in-order execution of the operations
+TEST_F(core_host_async_copy_test, in_order) {
+
+    static constexpr unsigned int SIZE = 10000;
+    vecmem::vector<int> a(SIZE, &m_resource), b(SIZE, &m_resource),
+        c(SIZE, &m_resource);
+    std::iota(a.begin(), a.end(), 0);
+
+    // Issue the operations while the pool is busy.
+    auto promise = block_pool();
+    m_copy(vecmem::get_data(a), vecmem::get_data(b));
+    m_copy(vecmem::get_data(b), vecmem::get_data(c));
+    vecmem::copy::event_type event = m_copy.memset(vecmem::get_data(b), 0);
+    EXPECT_FALSE(event->is_ready());
+
+    // Release the pool, and wait for the operations to finish.
+    promise->set_value();
+    event->wait();
+    EXPECT_TRUE(event->is_ready());
+    EXPECT_EQ(a, c);
+    EXPECT_TRUE(std::all_of(b.begin(), b.end(), [](int i) { return i == 0; }));
+
+    // Events of small, synchronous operations should be complete.
+    vecmem::vector<int> d(10, 1, &m_resource), e(10, &m_resource);
+    EXPECT_TRUE(m_copy(vecmem::get_data(d), vecmem::get_data(e))->is_ready());
+    EXPECT_EQ(d, e);
+}
+
+/// Tests for combining the events of multiple copy objects
+TEST_F(core_host_async_copy_test, when_all) {
+
+    static constexpr unsigned int SIZE = 10000;
+    vecmem::vector<int> a(SIZE, &m_resource), b(SIZE, &m_resource),
+        c(SIZE, &m_resource);
+    std::iota(a.begin(), a.end(), 0);
+
+    vecmem::host::async_copy other{m_pool, small_threshold()};
+    auto promise = block_pool();
+    std::vector<vecmem::event_ptr> events;
+    events.push_back(m_copy(vecmem::get_data(a), vecmem::get_data(b)));
+    events.push_back(other(vecmem::get_data(a), vecmem::get_data(c)));
+    vecmem::event_ptr all = vecmem::when_all(std::move(events));
+    EXPECT_FALSE(all->is_ready());
+
+    promise->set_value();
+    all->wait();
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a, c);
+}
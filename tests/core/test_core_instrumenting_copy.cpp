@@ -0,0 +1,207 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+#include "vecmem/utils/instrumenting_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Test case for testing @c vecmem::instrumenting_copy
+class core_instrumenting_copy_test : public testing::Test {
+
+protected:
+    /// Memory resource for the test(s)
+    vecmem::host_memory_resource m_resource;
+    /// The copy object being instrumented
+    vecmem::copy m_upstream;
+    /// The instrumenting copy object
+    vecmem::instrumenting_copy m_copy{m_upstream};
+
+};  // class core_instrumenting_copy_test
+
+/// Tests for the histogram binning
+TEST_F(core_instrumenting_copy_test, histogram) {
+
+    using histogram = vecmem::instrumenting_copy::histogram;
+    EXPECT_EQ(histogram::bin(0u), 0u);
+    EXPECT_EQ(histogram::bin(1u), 1u);
+    EXPECT_EQ(histogram::bin(2u), 2u);
+    EXPECT_EQ(histogram::bin(3u), 2u);
+    EXPECT_EQ(histogram::bin(1024u), 11u);
+    EXPECT_EQ(histogram::bin(~0ull), histogram::n_bins - 1);
+
+    histogram h;
+    h.fill(5u);
+    h.fill(6u);
+    h += h;
+    EXPECT_EQ(h.counts[3], 4u);
+}
+
+/// Tests for counting simple copies
+TEST_F(core_instrumenting_copy_test, vector) {
+
+    vecmem::vector<int> source(100, &m_resource), target(100, &m_resource);
+    std::iota(source.begin(), source.end(), 0);
+
+    m_copy(vecmem::get_data(source), vecmem::get_data(target),
+           vecmem::copy::type::host_to_host)
+        ->wait();
+    EXPECT_EQ(source, target);
+
+    const vecmem::instrumenting_copy::statistics stats =
+        m_copy.get_statistics(vecmem::copy::type::host_to_host);
+    EXPECT_EQ(stats.calls, 1u);
+    EXPECT_EQ(stats.copies, 1u);
+    EXPECT_EQ(stats.bytes, 100 * sizeof(int));
+    EXPECT_EQ(stats.sizes.counts[vecmem::instrumenting_copy::histogram::bin(
+                  100 * sizeof(int))],
+              1u);
+    std::size_t n_latencies = 0;
+    for (std::size_t count : stats.latencies.counts) {
+        n_latencies += count;
+    }
+    EXPECT_EQ(n_latencies, 1u);
+
+    // Nothing should have been recorded for other copy types.
+    EXPECT_EQ(m_copy.get_statistics(vecmem::copy::type::host_to_device).calls,
+              0u);
+
+    // Test the memory filling statistics.
+    m_copy.memset(vecmem::get_data(target), 0)->wait();
+    EXPECT_EQ(m_copy.get_memset_statistics().calls, 1u);
+    EXPECT_EQ(m_copy.get_memset_statistics().bytes, 100 * sizeof(int));
+
+    // Test resetting the statistics.
+    m_copy.reset();
+    EXPECT_EQ(m_copy.get_statistics(vecmem::copy::type::host_to_host).calls,
+              0u);
+    EXPECT_TRUE(m_copy.get_tags().empty());
+}
+
+/// Tests for counting the copies of jagged vectors, with tags
+TEST_F(core_instrumenting_copy_test, tags) {
+
+    // Create a (non-contiguous) jagged vector.
+    vecmem::jagged_vector<int> source(&m_resource);
+    for (std::size_t i = 0; i < 10; ++i) {
+        source.emplace_back(i + 1, static_cast<int>(i));
+    }
+
+    // Copy it into a buffer, with a tag.
+    std::vector<std::size_t> sizes(10);
+    std::iota(sizes.begin(), sizes.end(), 1u);
+    vecmem::data::jagged_vector_buffer<int> buffer(sizes, m_resource);
+    {
+        vecmem::instrumenting_copy::scoped_tag tag(m_copy, "jagged");
+        EXPECT_EQ(m_copy.get_tag(), "jagged");
+        m_copy(vecmem::get_data(source), buffer,
+               vecmem::copy::type::host_to_host)
+            ->wait();
+    }
+    EXPECT_EQ(m_copy.get_tag(), "");
+
+    // Copy a vector without a tag.
+    vecmem::vector<int> vsource(10, &m_resource), vtarget(10, &m_resource);
+    m_copy(vecmem::get_data(vsource), vecmem::get_data(vtarget),
+           vecmem::copy::type::host_to_host)
+        ->wait();
+
+    // Check the results.
+    EXPECT_EQ(m_copy.get_tags(), (std::vector<std::string>{"", "jagged"}));
+    const vecmem::instrumenting_copy::statistics jagged =
+        m_copy.get_statistics("jagged", vecmem::copy::type::host_to_host);
+    EXPECT_GE(jagged.copies, 10u);
+    EXPECT_GE(jagged.bytes, 55 * sizeof(int));
+    EXPECT_EQ(
+        m_copy.get_statistics("", vecmem::copy::type::host_to_host).copies,
+        1u);
+    EXPECT_EQ(m_copy.get_statistics(vecmem::copy::type::host_to_host).copies,
+              jagged.copies + 1u);
+    EXPECT_EQ(
+        m_copy.get_statistics("unknown", vecmem::copy::type::host_to_host)
+            .calls,
+        0u);
+}
+
+/// Tests for using different tags on different threads
+TEST_F(core_instrumenting_copy_test, thread_tags) {
+
+    vecmem::vector<int> source(10, &m_resource), target(10, &m_resource);
+    vecmem::instrumenting_copy::scoped_tag tag(m_copy, "main");
+    std::thread thread([&]() {
+        EXPECT_EQ(m_copy.get_tag(), "");
+        vecmem::instrumenting_copy::scoped_tag other(m_copy, "other");
+        m_copy(vecmem::get_data(source), vecmem::get_data(target),
+               vecmem::copy::type::host_to_host)
+            ->wait();
+    });
+    thread.join();
+    EXPECT_EQ(m_copy.get_tag(), "main");
+    m_copy(vecmem::get_data(source), vecmem::get_data(target),
+           vecmem::copy::type::host_to_host)
+        ->wait();
+
+    EXPECT_EQ(m_copy.get_tags(), (std::vector<std::string>{"main", "other"}));
+    EXPECT_EQ(
+        m_copy.get_statistics("main", vecmem::copy::type::host_to_host).copies,
+        1u);
+    EXPECT_EQ(
+        m_copy.get_statistics("other", vecmem::copy::type::host_to_host)
+            .copies,
+        1u);
+}
+
+/// Tests for the copy hooks
+TEST_F(core_instrumenting_copy_test, hooks) {
+
+    std::size_t pre_bytes = 0, post_bytes = 0;
+    m_copy.add_pre_copy_hook(
+        [&pre_bytes](std::size_t size, const void*, void*,
+                     vecmem::copy::type::copy_type) { pre_bytes += size; });
+    m_copy.add_post_copy_hook(
+        [&post_bytes](std::size_t size, const void*, void*,
+                      vecmem::copy::type::copy_type,
+                      std::uint64_t) { post_bytes += size; });
+
+    std::size_t batches = 0, batch_bytes = 0;
+    m_copy.add_post_copy_batch_hook(
+        [&](const std::vector<vecmem::copy::segment>& segments,
+            vecmem::copy::type::copy_type, std::uint64_t) {
+            ++batches;
+            for (const vecmem::copy::segment& seg : segments) {
+                batch_bytes += seg.size;
+            }
+        });
+
+    vecmem::vector<int> source(100, &m_resource), target(100, &m_resource);
+    m_copy(vecmem::get_data(source), vecmem::get_data(target))->wait();
+    EXPECT_EQ(pre_bytes, 100 * sizeof(int));
+    EXPECT_EQ(post_bytes, 100 * sizeof(int));
+    EXPECT_EQ(batches, 0u);
+
+    // Batches are reported once, to the batch hooks.
+    vecmem::copy_batch batch(m_copy);
+    batch.add(16, source.data(), target.data());
+    batch.add(16, source.data() + 10, target.data() + 10);
+    m_copy(batch)->wait();
+    EXPECT_EQ(pre_bytes, 100 * sizeof(int) + 32);
+    EXPECT_EQ(post_bytes, 100 * sizeof(int));
+    EXPECT_EQ(batches, 1u);
+    EXPECT_EQ(batch_bytes, 32u);
+}
@@ -0,0 +1,216 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+#include "vecmem/utils/parallel_host_copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+/// Test case for testing @c vecmem::parallel_host_copy
+class core_parallel_host_copy_test : public testing::Test {
+
+protected:
+    /// Configuration making even small copies run on multiple threads
+    static vecmem::parallel_host_copy::config small_chunks() {
+        vecmem::parallel_host_copy::config cfg;
+        cfg.parallel_threshold = 1024;
+        cfg.min_chunk_size = 256;
+        return cfg;
+    }
+
+    /// Memory resource for the test(s)
+    vecmem::host_memory_resource m_resource;
+    /// Thread pool for the test(s)
+    vecmem::thread_pool m_pool{3};
+    /// Copy object for the test(s)
+    vecmem::parallel_host_copy m_copy{m_pool, small_chunks()};
+
+};  // class core_parallel_host_copy_test
+
+/// Tests for the configuration of the copy object
+TEST_F(core_parallel_host_copy_test, config) {
+
+    EXPECT_EQ(m_copy.get_config().parallel_threshold, 1024u);
+    EXPECT_EQ(m_copy.get_config().min_chunk_size, 256u);
+
+    vecmem::parallel_host_copy copy(2);
+    EXPECT_EQ(copy.get_config().parallel_threshold,
+              vecmem::parallel_host_copy::config{}.parallel_threshold);
+}
+
+/// Tests for copying 1-dimensional vectors
+TEST_F(core_parallel_host_copy_test, vector) {
+
+    // Test both large and small vectors, with sizes that are not multiples of
+    // the chunk sizes.
+    for (std::size_t size : {3u, 200u, 1001u, 100003u}) {
+
+        // Create a reference vector.
+        vecmem::vector<int> reference(size, &m_resource);
+        std::iota(reference.begin(), reference.end(), 0);
+
+        // Copy it into a new buffer, and back into a vector.
+        vecmem::data::vector_buffer<int> buffer =
+            m_copy.to(vecmem::get_data(reference), m_resource);
+        vecmem::vector<int> result(&m_resource);
+        m_copy(buffer, result)->wait();
+
+        // Compare them.
+        EXPECT_EQ(reference, result);
+    }
+}
+
+/// Tests for filling 1-dimensional vectors
+TEST_F(core_parallel_host_copy_test, memset) {
+
+    // Create a buffer.
+    static constexpr unsigned int SIZE = 12345;
+    vecmem::data::vector_buffer<int> buffer(SIZE, m_resource);
+    m_copy.setup(buffer)->wait();
+
+    // Fill it, and check the result.
+    m_copy.memset(buffer, -1)->wait();
+    vecmem::device_vector<int> vec(buffer);
+    for (int value : vec) {
+        EXPECT_EQ(value, -1);
+    }
+}
+
+/// Tests for operations whose size is not a multiple of the chunk count
+TEST_F(core_parallel_host_copy_test, uneven_size) {
+
+    // A size that is split into 4 chunks, with the size of a chunk being a
+    // multiple of the chunk alignment, but with a remainder left over.
+    static constexpr unsigned int SIZE = 64 * 4 * 8 + 1;
+
+    // Copy a vector of that size.
+    vecmem::vector<char> reference(SIZE, &m_resource);
+    for (unsigned int i = 0; i < SIZE; ++i) {
+        reference[i] = static_cast<char>(i % 127 + 1);
+    }
+    vecmem::vector<char> result(SIZE, 0, &m_resource);
+    m_copy(vecmem::get_data(reference), vecmem::get_data(result))->wait();
+    EXPECT_EQ(reference, result);
+
+    // Fill the vector.
+    m_copy.memset(vecmem::get_data(result), 0)->wait();
+    for (char value : result) {
+        EXPECT_EQ(value, 0);
+    }
+}
+
+/// Tests for copying jagged vectors
+TEST_F(core_parallel_host_copy_test, jagged_vector) {
+
+    // Create a reference jagged vector, with inner vectors of varying sizes.
+    vecmem::jagged_vector<int> reference(&m_resource);
+    for (std::size_t i = 0; i < 20; ++i) {
+        reference.emplace_back(i * 137);
+        std::iota(reference.back().begin(), reference.back().end(),
+                  static_cast<int>(i));
+    }
+    auto reference_data = vecmem::get_data(reference);
+
+    // Copy it into a buffer, and back into a jagged vector.
+    vecmem::data::jagged_vector_buffer<int> buffer =
+        m_copy.to(reference_data, m_resource);
+    vecmem::jagged_vector<int> result(&m_resource);
+    m_copy(buffer, result)->wait();
+
+    // Compare them.
+    EXPECT_EQ(reference, result);
+}
+
+/// Tests for batched copies
+TEST_F(core_parallel_host_copy_test, batch) {
+
+    // Create a number of source and target vectors.
+    static constexpr std::size_t N_VECTORS = 10;
+    std::vector<vecmem::vector<int> > sources, targets;
+    for (std::size_t i = 0; i < N_VECTORS; ++i) {
+        sources.emplace_back((i + 1) * 333, &m_resource);
+        std::iota(sources.back().begin(), sources.back().end(),
+                  static_cast<int>(i));
+        targets.emplace_back((i + 1) * 333, &m_resource);
+    }
+
+    // Copy all of them in a single batch.
+    vecmem::copy_batch batch(m_copy);
+    for (std::size_t i = 0; i < N_VECTORS; ++i) {
+        batch.add(vecmem::get_data(sources[i]), vecmem::get_data(targets[i]));
+    }
+    m_copy(batch)->wait();
+
+    // Check the results.
+    EXPECT_EQ(sources, targets);
+}
+
+/// Tests for copies and fills using non-temporal stores
+TEST_F(core_parallel_host_copy_test, non_temporal) {
+
+    // Set up copy objects that use non-temporal stores for every operation,
+    // with and without splitting them up between multiple threads.
+    vecmem::parallel_host_copy::config cfg1 = small_chunks();
+    cfg1.non_temporal_threshold = 0;
+    vecmem::parallel_host_copy::config cfg2;
+    cfg2.non_temporal_threshold = 0;
+    const vecmem::parallel_host_copy copies[] = {{m_pool, cfg1},
+                                                 {m_pool, cfg2}};
+
+    // Use source and target memory blocks that are misaligned in all sorts of
+    // ways.
+    static constexpr std::size_t SIZE = 100000;
+    std::vector<char> source(SIZE), target(SIZE);
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        source[i] = static_cast<char>(i % 127);
+    }
+    for (const vecmem::parallel_host_copy& copy : copies) {
+        for (std::size_t from_offset : {0u, 1u, 17u, 64u}) {
+            for (std::size_t to_offset : {0u, 3u, 63u}) {
+                for (std::size_t size : {10u, 300u, 4097u, 90000u}) {
+
+                    // Perform a copy.
+                    std::fill(target.begin(), target.end(), 0);
+                    vecmem::copy_batch batch(copy);
+                    batch.add(size, source.data() + from_offset,
+                              target.data() + to_offset);
+                    copy(batch)->wait();
+                    EXPECT_TRUE(std::equal(
+                        source.begin() + from_offset,
+                        source.begin() + from_offset + size,
+                        target.begin() + to_offset));
+                    EXPECT_EQ(target[to_offset + size], 0);
+
+                    // Perform a fill.
+                    vecmem::data::vector_view<char> view(
+                        static_cast<unsigned int>(size),
+                        target.data() + to_offset);
+                    copy.memset(view, 42)->wait();
+                    EXPECT_TRUE(std::all_of(
+                        target.begin() + to_offset,
+                        target.begin() + to_offset + size,
+                        [](char c) { return c == 42; }));
+                    EXPECT_EQ(target[to_offset + size], 0);
+                }
+            }
+        }
+    }
+}
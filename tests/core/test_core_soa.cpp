@@ -0,0 +1,210 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/data/soa_buffer.hpp"
+#include "vecmem/containers/data/soa_view.hpp"
+#include "vecmem/containers/soa_device.hpp"
+#include "vecmem/containers/soa_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+/// Copy object counting the "low level" operations that it performs
+class counting_copy : public vecmem::copy {
+
+public:
+    /// The number of @c do_copy_batch calls made
+    mutable std::size_t m_batches = 0;
+    /// The number of segments copied with @c do_copy_batch
+    mutable std::size_t m_segments = 0;
+
+protected:
+    void do_copy_batch(const std::vector<segment>& segments,
+                       type::copy_type cptype) const override {
+        ++m_batches;
+        m_segments += segments.size();
+        vecmem::copy::do_copy_batch(segments, cptype);
+    }
+
+};  // class counting_copy
+
+}  // namespace
+
+/// Test case for the struct-of-arrays containers
+class core_soa_test : public testing::Test {
+
+protected:
+    /// Collection type used in the tests
+    typedef vecmem::soa_vector<float, int, std::uint8_t> host_type;
+    /// Buffer type used in the tests
+    typedef vecmem::data::soa_buffer<float, int, std::uint8_t> buffer_type;
+    /// Device type used in the tests
+    typedef vecmem::soa_device<float, int, std::uint8_t> device_type;
+
+    /// Fill a host collection with some reference values
+    static void fill(host_type& vec, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            vec.push_back(static_cast<float>(i) * 0.5f, static_cast<int>(i),
+                          static_cast<std::uint8_t>(i % 256));
+        }
+    }
+
+    /// Memory resource for the test(s)
+    vecmem::host_memory_resource m_resource;
+    /// Copy object for the test(s)
+    counting_copy m_copy;
+
+};  // class core_soa_test
+
+/// Tests for the host container
+TEST_F(core_soa_test, host) {
+
+    host_type vec(m_resource);
+    EXPECT_TRUE(vec.empty());
+    fill(vec, 10);
+    EXPECT_EQ(vec.size(), 10u);
+    EXPECT_EQ(vec.column<1>().size(), 10u);
+
+    // Access the elements through the proxies.
+    vec[3].get<0>() = 42.f;
+    EXPECT_FLOAT_EQ(vec.column<0>()[3], 42.f);
+    const host_type& cvec = vec;
+    EXPECT_EQ(cvec[4].get<1>(), 4);
+    EXPECT_EQ(cvec[4].index(), 4u);
+    static_assert(
+        std::is_same<decltype(cvec[4].get<1>()), const int&>::value,
+        "Constant proxies must provide constant references");
+
+    // Resize and clear the collection.
+    vec.resize(20);
+    EXPECT_EQ(vec.size(), 20u);
+    EXPECT_EQ(vec.column<2>().size(), 20u);
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+}
+
+/// Tests for the buffer type
+TEST_F(core_soa_test, buffer) {
+
+    // Fixed sized buffer.
+    buffer_type fixed(100, m_resource);
+    EXPECT_EQ(fixed.size(), 100u);
+    EXPECT_EQ(fixed.capacity(), 100u);
+    EXPECT_EQ(fixed.size_ptr(), nullptr);
+
+    // Resizable buffer.
+    buffer_type resizable(100, 0, m_resource);
+    EXPECT_NE(resizable.size_ptr(), nullptr);
+    m_copy.setup(resizable)->wait();
+    EXPECT_EQ(resizable.size(), 0u);
+
+    // Check the alignment of all of the columns.
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(resizable.ptr<0>()) %
+                  alignof(float),
+              0u);
+    EXPECT_EQ(
+        reinterpret_cast<std::uintptr_t>(resizable.ptr<1>()) % alignof(int),
+        0u);
+
+    // Check that the columns share the size of the collection.
+    EXPECT_EQ(resizable.column<1>().size_ptr(), resizable.size_ptr());
+    EXPECT_EQ(resizable.column<2>().capacity(), 100u);
+
+    // Fill the memory of the buffer.
+    m_copy.memset(fixed, 0)->wait();
+    for (unsigned int i = 0; i < fixed.size(); ++i) {
+        EXPECT_EQ(fixed.ptr<1>()[i], 0);
+    }
+
+    // Null-capacity buffers.
+    buffer_type empty(0, m_resource);
+    EXPECT_EQ(empty.capacity(), 0u);
+}
+
+/// Tests for the device type
+TEST_F(core_soa_test, device) {
+
+    buffer_type buffer(50, 0, m_resource);
+    m_copy.setup(buffer)->wait();
+
+    device_type device(buffer);
+    EXPECT_TRUE(device.empty());
+    EXPECT_EQ(device.capacity(), 50u);
+    for (unsigned int i = 0; i < 20; ++i) {
+        EXPECT_EQ(device.push_back(static_cast<float>(i), static_cast<int>(i),
+                                   static_cast<std::uint8_t>(i)),
+                  i);
+    }
+    EXPECT_EQ(device.size(), 20u);
+    EXPECT_EQ(buffer.size(), 20u);
+
+    // Access the elements.
+    for (unsigned int i = 0; i < device.size(); ++i) {
+        EXPECT_FLOAT_EQ(device[i].get<0>(), static_cast<float>(i));
+        EXPECT_EQ(device.get<1>(i), static_cast<int>(i));
+    }
+    device[5].get<2>() = 200;
+    EXPECT_EQ(device.column<2>()[5], 200);
+    EXPECT_EQ(device.column<2>().size(), 20u);
+
+    // Access through a constant view.
+    const vecmem::data::soa_view<const float, const int, const std::uint8_t>
+        cview = buffer;
+    vecmem::soa_device<const float, const int, const std::uint8_t> cdevice(
+        cview);
+    EXPECT_EQ(cdevice.size(), 20u);
+    EXPECT_EQ(cdevice[5].get<2>(), 200);
+}
+
+/// Tests for copying whole collections
+TEST_F(core_soa_test, copy) {
+
+    // Create a host collection.
+    host_type input(m_resource);
+    fill(input, 1000);
+
+    // Copy it into a fixed sized buffer.
+    buffer_type fixed(1000, m_resource);
+    m_copy(vecmem::get_data(input), fixed)->wait();
+    EXPECT_EQ(m_copy.m_batches, 1u);
+    EXPECT_EQ(m_copy.m_segments, 3u);
+
+    // Copy it into a resizable buffer.
+    buffer_type resizable(2000, 0, m_resource);
+    m_copy.setup(resizable)->wait();
+    m_copy(vecmem::get_data(input), resizable)->wait();
+    EXPECT_EQ(m_copy.m_batches, 2u);
+    EXPECT_EQ(resizable.size(), 1000u);
+    EXPECT_EQ(m_copy.get_size(resizable), 1000u);
+
+    // Copy it back into a host collection.
+    host_type output(m_resource);
+    output.resize(m_copy.get_size(resizable));
+    m_copy(resizable, vecmem::get_data(output))->wait();
+    EXPECT_EQ(m_copy.m_batches, 3u);
+    for (unsigned int i = 0; i < input.size(); ++i) {
+        EXPECT_FLOAT_EQ(output[i].get<0>(), input[i].get<0>());
+        EXPECT_EQ(output[i].get<1>(), input[i].get<1>());
+        EXPECT_EQ(output[i].get<2>(), input[i].get<2>());
+    }
+
+    // Copies into too small targets must fail.
+    buffer_type small(10, m_resource);
+    EXPECT_THROW(m_copy(vecmem::get_data(input), small), std::length_error);
+}
@@ -0,0 +1,91 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+/// Test the construction of thread pools
+TEST(core_thread_pool_test, construct) {
+
+    vecmem::thread_pool pool1(3);
+    EXPECT_EQ(pool1.size(), 3u);
+
+    vecmem::thread_pool pool2;
+    EXPECT_GE(pool2.size(), 1u);
+}
+
+/// Test the asynchronous execution of tasks
+TEST(core_thread_pool_test, submit) {
+
+    vecmem::thread_pool pool(2);
+
+    std::promise<int> promise;
+    std::future<int> future = promise.get_future();
+    pool.submit([&promise]() { promise.set_value(42); });
+    EXPECT_EQ(future.get(), 42);
+}
+
+/// Test that all indices are processed exactly once by parallel_for
+TEST(core_thread_pool_test, parallel_for) {
+
+    vecmem::thread_pool pool(4);
+
+    static constexpr std::size_t N_TASKS = 1000;
+    std::vector<std::atomic<int> > counts(N_TASKS);
+    for (std::atomic<int>& count : counts) {
+        count = 0;
+    }
+    pool.parallel_for(N_TASKS, [&counts](std::size_t i) { ++(counts[i]); });
+    for (const std::atomic<int>& count : counts) {
+        EXPECT_EQ(count.load(), 1);
+    }
+
+    // Make sure that empty and trivial loops work as well.
+    pool.parallel_for(0, [](std::size_t) { FAIL(); });
+    std::size_t index = 1;
+    pool.parallel_for(1, [&index](std::size_t i) { index = i; });
+    EXPECT_EQ(index, 0u);
+}
+
+/// Test that parallel_for can be called from inside the pool
+TEST(core_thread_pool_test, nested_parallel_for) {
+
+    vecmem::thread_pool pool(2);
+
+    std::atomic<int> count{0};
+    pool.parallel_for(4, [&](std::size_t) {
+        pool.parallel_for(10, [&count](std::size_t) { ++count; });
+    });
+    EXPECT_EQ(count.load(), 40);
+}
+
+/// Test the propagation of exceptions out of parallel_for
+TEST(core_thread_pool_test, parallel_for_exception) {
+
+    vecmem::thread_pool pool(2);
+
+    std::atomic<int> count{0};
+    EXPECT_THROW(pool.parallel_for(100,
+                                   [&count](std::size_t i) {
+                                       ++count;
+                                       if (i == 50) {
+                                           throw std::runtime_error("test");
+                                       }
+                                   }),
+                 std::runtime_error);
+    // All indices should still have been processed.
+    EXPECT_EQ(count.load(), 100);
+}
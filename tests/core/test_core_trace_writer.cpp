@@ -0,0 +1,125 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/instrumenting_memory_resource.hpp"
+#include "vecmem/utils/instrumenting_copy.hpp"
+#include "vecmem/utils/trace_writer.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+/// Count the occurrences of a string in another one
+std::size_t count(const std::string& str, const std::string& what) {
+    std::size_t result = 0;
+    for (std::size_t pos = str.find(what); pos != std::string::npos;
+         pos = str.find(what, pos + what.size())) {
+        ++result;
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Test recording user defined events
+TEST(core_trace_writer_test, user_events) {
+
+    std::ostringstream output;
+    {
+        vecmem::trace_writer writer(output, 2);
+        {
+            vecmem::trace_writer::scoped_event event(writer, "outer");
+            writer.instant("marker", "test", 42);
+        }
+        writer.complete("slice", "test", 1500, 2001, 10);
+
+        // The first two events should have been written out already.
+        EXPECT_EQ(count(output.str(), "\"name\""), 2u);
+
+        // Events from other threads should get a different thread id.
+        std::thread thread([&writer]() { writer.instant("other", "test"); });
+        thread.join();
+        writer.flush();
+        EXPECT_EQ(count(output.str(), "\"name\""), 4u);
+    }
+    const std::string json = output.str();
+
+    // Check the structure of the output.
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+    EXPECT_EQ(count(json, "{\"name\""), 4u);
+    EXPECT_EQ(count(json, "},\n{"), 3u);
+
+    // Check the contents of the events.
+    EXPECT_NE(json.find("\"name\":\"outer\",\"cat\":\"user\",\"ph\":\"X\""),
+              std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"i\""), std::string::npos);
+    EXPECT_NE(json.find("\"bytes\":42"), std::string::npos);
+    EXPECT_NE(json.find("\"ts\":1.500,\"dur\":2.001"), std::string::npos);
+    EXPECT_EQ(count(json, "\"tid\":"), 4u);
+    const std::string other_tid =
+        json.substr(json.find("\"tid\":", json.find("\"other\"")), 8);
+    const std::string outer_tid =
+        json.substr(json.find("\"tid\":", json.find("\"outer\"")), 8);
+    EXPECT_NE(other_tid, outer_tid);
+}
+
+/// Test recording events with long names, and names that need escaping
+TEST(core_trace_writer_test, special_names) {
+
+    static const std::string long_name(2000, 'x');
+    std::ostringstream output;
+    {
+        vecmem::trace_writer writer(output);
+        writer.instant(long_name.c_str(), "test", 1);
+        writer.instant("\"quoted\" \\path\\", "new\nline", 2);
+    }
+    const std::string json = output.str();
+
+    EXPECT_NE(json.find("\"name\":\"" + long_name + "\",\"cat\":\"test\""),
+              std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"\\\"quoted\\\" \\\\path\\\\\","
+                        "\"cat\":\"new\\u000aline\""),
+              std::string::npos);
+    EXPECT_EQ(count(json, "\"bytes\":"), 2u);
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+}
+
+/// Test recording allocations and copies
+TEST(core_trace_writer_test, instrumented) {
+
+    std::ostringstream output;
+    {
+        vecmem::trace_writer writer(output);
+        vecmem::host_memory_resource upstream;
+        vecmem::instrumenting_memory_resource resource(upstream);
+        vecmem::copy host_copy;
+        vecmem::instrumenting_copy copy(host_copy);
+        writer.attach(resource);
+        writer.attach(copy);
+
+        vecmem::vector<int> source(100, &resource), target(100, &resource);
+        copy(vecmem::get_data(source), vecmem::get_data(target),
+             vecmem::copy::type::host_to_host)
+            ->wait();
+    }
+    const std::string json = output.str();
+
+    EXPECT_EQ(count(json, "\"name\":\"allocate\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"deallocate\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"host_to_host\",\"cat\":\"copy\""), 1u);
+    EXPECT_EQ(count(json, "\"bytes\":400"), 5u);
+}
@@ -0,0 +1,108 @@
+/* VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// VecMem include(s).
+#include "vecmem/containers/tracked_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/dirty_ranges.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/// Helper function flattening the ranges of a tracker
+std::vector<std::size_t> flatten(const vecmem::dirty_ranges& dirty) {
+
+    std::vector<std::size_t> result;
+    for (const vecmem::dirty_ranges::range& r : dirty.ranges()) {
+        result.push_back(r.begin);
+        result.push_back(r.end);
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Test the merging of modified ranges
+TEST(core_dirty_ranges_test, merge) {
+
+    vecmem::dirty_ranges dirty;
+    EXPECT_TRUE(dirty.empty());
+
+    // Sequential modifications should end up in a single range.
+    for (std::size_t i = 10; i < 20; ++i) {
+        dirty.mark(i);
+    }
+    EXPECT_EQ(flatten(dirty), std::vector<std::size_t>({10, 20}));
+
+    // Out of order, and overlapping ranges.
+    dirty.mark(50, 60);
+    dirty.mark(0, 5);
+    dirty.mark(55, 70);
+    dirty.mark(5, 6);
+    dirty.mark(30, 30);
+    EXPECT_EQ(flatten(dirty),
+              std::vector<std::size_t>({0, 6, 10, 20, 50, 70}));
+
+    // A large enough merge gap should merge everything.
+    dirty.set_merge_gap(30);
+    EXPECT_EQ(flatten(dirty), std::vector<std::size_t>({0, 70}));
+
+    // Clearing the tracker.
+    dirty.clear();
+    EXPECT_TRUE(dirty.empty());
+    EXPECT_TRUE(dirty.ranges().empty());
+}
+
+/// Test that many scattered modifications are kept compact
+TEST(core_dirty_ranges_test, compaction) {
+
+    vecmem::dirty_ranges dirty;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        dirty.mark((i * 7919) % 1000);
+    }
+    EXPECT_EQ(flatten(dirty), std::vector<std::size_t>({0, 1000}));
+}
+
+/// Test the tracking of modifications in a vector
+TEST(core_tracked_vector_test, modify) {
+
+    vecmem::host_memory_resource resource;
+    vecmem::tracked_vector<int> vec(100, 1, resource);
+    EXPECT_EQ(vec.size(), 100u);
+    EXPECT_EQ(flatten(vec.dirty()), std::vector<std::size_t>({0, 100}));
+    vec.dirty().clear();
+
+    // Modify a few elements.
+    vec.set(10, 2);
+    vec.modify(11) = 3;
+    int* ptr = vec.modify(50, 55);
+    for (int i = 0; i < 5; ++i) {
+        ptr[i] = 4;
+    }
+    EXPECT_EQ(vec[10], 2);
+    EXPECT_EQ(vec.at(11), 3);
+    EXPECT_EQ(vec[54], 4);
+    EXPECT_EQ(flatten(vec.dirty()),
+              std::vector<std::size_t>({10, 12, 50, 55}));
+
+    // Invalid modifications.
+    EXPECT_THROW(vec.modify(100), std::out_of_range);
+    EXPECT_THROW(vec.modify(90, 101), std::out_of_range);
+
+    // Resizing marks the whole vector.
+    vec.resize(20);
+    EXPECT_EQ(flatten(vec.dirty()), std::vector<std::size_t>({0, 20}));
+    auto view = vecmem::get_data(vec);
+    EXPECT_EQ(view.size(), 20u);
+    EXPECT_EQ(view.ptr(), vec.data());
+}